@@ -90,7 +90,7 @@ class Cell {
   unsigned nnodes() const { return nodes_.size(); }
 
   //! Return nodes of the cell
-  std::vector<std::shared_ptr<mpm::NodeBase<Tdim>>> nodes() const {
+  const std::vector<std::shared_ptr<mpm::NodeBase<Tdim>>>& nodes() const {
     return nodes_;
   }
 
@@ -158,7 +158,27 @@ class Cell {
   Eigen::Matrix<double, Tdim, 1> centroid() const { return centroid_; }
 
   //! Return the dN/dx at the centroid of the cell
-  Eigen::MatrixXd dn_dx_centroid() const { return dn_dx_centroid_; }
+  const Eigen::MatrixXd& dn_dx_centroid() const { return dn_dx_centroid_; }
+
+  //! Compute the volumetric strain rate at the centroid from nodal velocities
+  //! \details Shared by the particles of the cell until it is reset
+  //! \param[in] phase Index corresponding to the phase
+  void compute_volumetric_strain_rate_centroid(unsigned phase) noexcept;
+
+  //! Return if the volumetric strain rate at the centroid is computed
+  bool volumetric_strain_rate_centroid_computed() const {
+    return volumetric_strain_rate_centroid_computed_;
+  }
+
+  //! Return the volumetric strain rate at the centroid of the cell
+  double volumetric_strain_rate_centroid() const {
+    return volumetric_strain_rate_centroid_;
+  }
+
+  //! Discard the volumetric strain rate at the centroid of the cell
+  void reset_volumetric_strain_rate_centroid() {
+    volumetric_strain_rate_centroid_computed_ = false;
+  }
 
   //! Compute mean length of cell
   void compute_mean_length();
@@ -217,11 +237,19 @@ class Cell {
   //! Return previous mpi rank
   unsigned previous_mpirank() const;
 
+  //! Return if the cell is a parallelogram / parallelepiped, for which the
+  //! affine transformation to the unit cell is exact
+  bool is_parallelepiped() const { return parallelepiped_; }
+
  private:
   //! Approximately check if a point is in a cell
   //! \param[in] point Coordinates of point
   bool approx_point_in_cell(const Eigen::Matrix<double, Tdim, 1>& point);
 
+  //! Compute geometry used to locate points: bounding box, transposed
+  //! nodal coordinates and the inverse of the affine transformation
+  void compute_geometry_cache();
+
  private:
   //! Mutex
   std::mutex cell_mutex_;
@@ -257,6 +285,30 @@ class Cell {
   std::shared_ptr<Quadrature<Tdim>> quadrature_{nullptr};
   //! dN/dx
   Eigen::MatrixXd dn_dx_centroid_;
+  //! Volumetric strain rate at the centroid
+  double volumetric_strain_rate_centroid_{0.};
+  //! Status of the volumetric strain rate at the centroid
+  bool volumetric_strain_rate_centroid_computed_{false};
+  //! Status of cached geometry
+  bool geometry_cached_{false};
+  //! Number of corner nodes
+  unsigned ncorners_{0};
+  //! Lower corner of the axis-aligned bounding box of a linear cell
+  VectorDim bbox_min_;
+  //! Upper corner of the axis-aligned bounding box of a linear cell
+  VectorDim bbox_max_;
+  //! Status of bounding box
+  bool bbox_{false};
+  //! Transposed nodal coordinates (Tdim x nnodes)
+  Eigen::Matrix<double, Tdim, Eigen::Dynamic> nodal_coords_;
+  //! Status of the cached affine transformation
+  bool affine_{false};
+  //! Inverse of the affine transformation A = vertex * KA
+  Eigen::Matrix<double, Tdim, Tdim> affine_inverse_;
+  //! Offset of the affine transformation b = vertex * Kb
+  VectorDim affine_offset_;
+  //! Parallelogram / parallelepiped with an exact affine transformation
+  bool parallelepiped_{false};
   //! Velocity constraints
   //! key: face_id, value: pair of direction [0/1/2] and velocity value
   std::map<unsigned, std::vector<std::pair<unsigned, double>>>
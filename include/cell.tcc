@@ -49,6 +49,9 @@ bool mpm::Cell<Tdim>::initialise() {
       dn_dx_centroid_ =
           element_->dn_dx(xi_centroid, this->nodal_coordinates_, zero, zero);
 
+      // Geometry to locate points in the cell
+      this->compute_geometry_cache();
+
       status = true;
     } else {
       throw std::runtime_error(
@@ -60,6 +63,52 @@ bool mpm::Cell<Tdim>::initialise() {
   return status;
 }
 
+//! Compute geometry used to locate points in the cell
+template <unsigned Tdim>
+void mpm::Cell<Tdim>::compute_geometry_cache() {
+  // Number of vertices of the affine transformation
+  const int nvertices = (Tdim == 1 ? 2 : (Tdim == 2 ? 4 : 8));
+
+  ncorners_ = element_->corner_indices().size();
+  nodal_coords_ = nodal_coordinates_.transpose();
+
+  // Cells with straight edges lie within the bounding box of their nodes
+  bbox_ = (element_->degree() == mpm::ElementDegree::Linear);
+  if (bbox_) {
+    const double tolerance = 1.0E-10 * mean_length_;
+    bbox_min_ = nodal_coords_.rowwise().minCoeff().array() - tolerance;
+    bbox_max_ = nodal_coords_.rowwise().maxCoeff().array() + tolerance;
+  }
+
+  // Affine transformation of linear quadrilateral / hexahedron cells
+  affine_ = (element_->degree() == mpm::ElementDegree::Linear &&
+             nodal_coords_.cols() == nvertices);
+  parallelepiped_ = false;
+  if (affine_) {
+    const Eigen::Matrix<double, Tdim, Tdim> A =
+        nodal_coords_ * mpm::TransformR2UAffine<Tdim, nvertices>::KA;
+    affine_offset_ =
+        nodal_coords_ * mpm::TransformR2UAffine<Tdim, nvertices>::Kb;
+    affine_inverse_ = A.inverse();
+    affine_ = affine_inverse_.allFinite();
+
+    // A cell is a parallelepiped if the affine map reproduces all vertices
+    // (vertices ordered as in the unit cell of the affine transformation)
+    parallelepiped_ = affine_;
+    const double tolerance = 1.0E-16 * mean_length_ * mean_length_;
+    for (int i = 0; i < nvertices && parallelepiped_; ++i) {
+      VectorDim unit_vertex;
+      unit_vertex(0) = (i % 4 == 1 || i % 4 == 2) ? 1. : -1.;
+      if (Tdim > 1) unit_vertex(1) = (i % 4 >= 2) ? 1. : -1.;
+      if (Tdim > 2) unit_vertex(2) = (i >= 4) ? 1. : -1.;
+      const VectorDim residual =
+          A * unit_vertex + affine_offset_ - nodal_coords_.col(i);
+      if (residual.squaredNorm() > tolerance) parallelepiped_ = false;
+    }
+  }
+  geometry_cached_ = true;
+}
+
 //! Return the initialisation status of cells
 //! \retval initialisation_status Cell has nodes, shape functions and volumes
 template <unsigned Tdim>
@@ -248,6 +297,26 @@ void mpm::Cell<Tdim>::compute_centroid() {
   centroid_ /= indices.size();
 }
 
+//! Compute the volumetric strain rate at the centroid from nodal velocities
+template <unsigned Tdim>
+void mpm::Cell<Tdim>::compute_volumetric_strain_rate_centroid(
+    unsigned phase) noexcept {
+  // Normal strain rates at the centroid
+  Eigen::Matrix<double, Tdim, 1> strain_rate =
+      Eigen::Matrix<double, Tdim, 1>::Zero();
+  for (unsigned i = 0; i < nodes_.size(); ++i) {
+    const Eigen::Matrix<double, Tdim, 1> velocity = nodes_[i]->velocity(phase);
+    for (unsigned j = 0; j < Tdim; ++j)
+      strain_rate[j] += dn_dx_centroid_(i, j) * velocity[j];
+  }
+
+  volumetric_strain_rate_centroid_ = 0.;
+  for (unsigned j = 0; j < Tdim; ++j)
+    if (std::fabs(strain_rate[j]) >= 1.E-15)
+      volumetric_strain_rate_centroid_ += strain_rate[j];
+  volumetric_strain_rate_centroid_computed_ = true;
+}
+
 //! Compute mean length of cell
 template <unsigned Tdim>
 void mpm::Cell<Tdim>::compute_mean_length() {
@@ -323,6 +392,11 @@ inline bool mpm::Cell<Tdim>::is_point_in_cell(
   // Set an initial value of Xi
   (*xi).fill(std::numeric_limits<double>::max());
 
+  // Reject points outside the bounding box of the cell
+  if (bbox_ && ((point.array() < bbox_min_.array()).any() ||
+                (point.array() > bbox_max_.array()).any()))
+    return false;
+
   // Check if point is approximately in the cell
   if (!this->approx_point_in_cell(point)) return false;
 
@@ -339,7 +413,10 @@ inline bool mpm::Cell<Tdim>::is_point_in_cell(
   // -1 and 1 if otherwise. Also, check if the transformed coordinate lies
   // exactly on cell edge.
   const double tolerance = std::numeric_limits<double>::epsilon();
-  if (this->element_->corner_indices().size() == 3) {
+  const unsigned ncorners = geometry_cached_
+                                ? ncorners_
+                                : this->element_->corner_indices().size();
+  if (ncorners == 3) {
     for (unsigned i = 0; i < (*xi).size(); ++i) {
       if ((*xi)(i) < 0. || (*xi)(i) > 1. - (*xi)(1 - i) || std::isnan((*xi)(i)))
         status = false;
@@ -538,11 +615,16 @@ inline Eigen::Matrix<double, Tdim, 1>
   // If regular cartesian grid use cartesian transformation
   if (!this->isoparametric_) return this->local_coordinates_point(point);
 
-  // Get indices of corner nodes
-  Eigen::VectorXi indices = element_->corner_indices();
+  // Exact affine transformation of a parallelogram / parallelepiped
+  if (parallelepiped_) return affine_inverse_ * (point - affine_offset_);
+
+  // Number of corner nodes
+  const unsigned ncorners = geometry_cached_
+                                ? ncorners_
+                                : this->element_->corner_indices().size();
 
   // Analytical solution for 2D linear triangle element
-  if (Tdim == 2 && indices.size() == 3) {
+  if (Tdim == 2 && ncorners == 3) {
     if (element_->isvalid_natural_coordinates_analytical())
       return element_->natural_coordinates_analytical(point,
                                                       this->nodal_coordinates_);
@@ -557,7 +639,10 @@ inline Eigen::Matrix<double, Tdim, 1>
       Eigen::Matrix<double, Tdim, 1>::Zero();
 
   // Matrix of nodal coordinates
-  const Eigen::MatrixXd nodal_coords = nodal_coordinates_.transpose();
+  Eigen::Matrix<double, Tdim, Eigen::Dynamic> transposed_coords;
+  if (!geometry_cached_) transposed_coords = nodal_coordinates_.transpose();
+  const auto& nodal_coords =
+      geometry_cached_ ? nodal_coords_ : transposed_coords;
 
   // Analytical xi
   Eigen::Matrix<double, Tdim, 1> analytical_xi;
@@ -610,17 +695,21 @@ inline Eigen::Matrix<double, Tdim, 1>
 
   // Affine transformation, using linear interpolation for the initial guess
   if (element_->degree() == mpm::ElementDegree::Linear) {
-    // A = vertex * KA
-    const Eigen::Matrix<double, Tdim, Tdim> A =
-        nodal_coords * mpm::TransformR2UAffine<Tdim, KA>::KA;
+    if (affine_) {
+      // Cached affine transform: A^-1 * (p - vertex * Kb)
+      affine_xi = affine_inverse_ * (point - affine_offset_);
+    } else {
+      // A = vertex * KA
+      const Eigen::Matrix<double, Tdim, Tdim> A =
+          nodal_coords * mpm::TransformR2UAffine<Tdim, KA>::KA;
 
-    // b = vertex * Kb
-    const Eigen::Matrix<double, Tdim, 1> b =
-        point - (nodal_coords * mpm::TransformR2UAffine<Tdim, KA>::Kb);
+      // b = vertex * Kb
+      const Eigen::Matrix<double, Tdim, 1> b =
+          point - (nodal_coords * mpm::TransformR2UAffine<Tdim, KA>::Kb);
 
-    // Affine transform: A^-1 * b
-    // const Eigen::Matrix<double, Tdim, 1>
-    affine_xi = A.inverse() * b;
+      // Affine transform: A^-1 * b
+      affine_xi = A.inverse() * b;
+    }
 
     // Check for nan
     for (unsigned i = 0; i < affine_xi.size(); ++i)
@@ -0,0 +1,175 @@
+#ifndef MPM_CELL_LIST_H_
+#define MPM_CELL_LIST_H_
+
+#include <cstddef>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include <tsl/robin_map.h>
+
+#include "data_types.h"
+
+namespace mpm {
+
+// Cell list class
+//! \brief Particle ids of cells and their neighbour cells
+//! \details Particle ids of all cells are stored in one array, cell by cell,
+//! so the particles of a cell are a contiguous range. A cell with neighbours
+//! keeps the slots of itself followed by its neighbour cells, and a query
+//! returns the ranges of these slots instead of copying particle ids. Cells
+//! are added serially, after which particles and neighbours of different
+//! cells can be assigned concurrently.
+class CellList {
+ public:
+  //! Range of particle ids
+  class Range {
+   public:
+    //! Constructor with first and past the last particle ids
+    Range(const mpm::Index* first, const mpm::Index* last)
+        : first_{first}, last_{last} {}
+
+    //! Begin iterator
+    const mpm::Index* begin() const { return first_; }
+
+    //! End iterator
+    const mpm::Index* end() const { return last_; }
+
+    //! Number of particles
+    std::size_t size() const { return last_ - first_; }
+
+    //! Range is empty
+    bool empty() const { return first_ == last_; }
+
+   private:
+    //! First particle id
+    const mpm::Index* first_;
+    //! Past the last particle id
+    const mpm::Index* last_;
+  };
+
+  //! Remove all cells
+  void clear() {
+    slots_.clear();
+    offsets_.assign(1, 0);
+    particles_.clear();
+    neighbours_.clear();
+  }
+
+  //! Add a cell
+  //! \param[in] id Cell id
+  //! \param[in] nparticles Number of particles in the cell
+  //! \retval status Cell is added, false if it is already present
+  bool add_cell(mpm::Index id, std::size_t nparticles) {
+    if (!slots_.insert({id, slots_.size()}).second) return false;
+    offsets_.emplace_back(offsets_.back() + nparticles);
+    return true;
+  }
+
+  //! Allocate storage of particles and neighbours of the added cells
+  void allocate() {
+    particles_.resize(offsets_.back());
+    neighbours_.assign(slots_.size(), std::vector<unsigned>());
+  }
+
+  //! Assign particles of a cell
+  //! \param[in] id Cell id
+  //! \param[in] first First particle id
+  //! \param[in] last Past the last particle id
+  //! \tparam Titr Iterator of particle ids
+  template <typename Titr>
+  void assign_particles(mpm::Index id, Titr first, Titr last) {
+    const unsigned slot = this->slot(id);
+    auto pitr = particles_.begin() + offsets_[slot];
+    for (; first != last && pitr != particles_.begin() + offsets_[slot + 1];
+         ++first, ++pitr)
+      *pitr = *first;
+  }
+
+  //! Assign neighbours of a cell, absent neighbours are skipped
+  //! \param[in] id Cell id
+  //! \param[in] neighbours Ids of the neighbour cells
+  void assign_neighbours(mpm::Index id,
+                         const std::set<mpm::Index>& neighbours) {
+    auto& slots = neighbours_.at(this->slot(id));
+    slots.clear();
+    slots.reserve(neighbours.size() + 1);
+    slots.emplace_back(this->slot(id));
+    for (const auto neighbour : neighbours) {
+      const auto sitr = slots_.find(neighbour);
+      if (sitr != slots_.end()) slots.emplace_back(sitr->second);
+    }
+  }
+
+  //! Return if a cell is present
+  //! \param[in] id Cell id
+  bool contains(mpm::Index id) const { return slots_.find(id) != slots_.end(); }
+
+  //! Number of cells
+  std::size_t ncells() const { return slots_.size(); }
+
+  //! Number of particles of all cells
+  std::size_t nparticles() const { return particles_.size(); }
+
+  //! Particles of a cell
+  //! \param[in] id Cell id
+  Range particles(mpm::Index id) const { return this->range(this->slot(id)); }
+
+  //! Ranges of particles of a cell and its neighbour cells
+  //! \param[in] id Cell id
+  std::vector<Range> neighbour_ranges(mpm::Index id) const {
+    std::vector<Range> ranges;
+    const auto& slots = neighbours_.at(this->slot(id));
+    ranges.reserve(slots.size());
+    for (const auto slot : slots) ranges.emplace_back(this->range(slot));
+    return ranges;
+  }
+
+  //! Number of particles of a cell and its neighbour cells
+  //! \param[in] id Cell id
+  std::size_t nneighbours(mpm::Index id) const {
+    std::size_t nparticles = 0;
+    for (const auto slot : neighbours_.at(this->slot(id)))
+      nparticles += offsets_[slot + 1] - offsets_[slot];
+    return nparticles;
+  }
+
+  //! Iterate over particles of a cell and its neighbour cells
+  //! \param[in] id Cell id
+  //! \param[in] oper Operation on a particle id
+  template <typename Toper>
+  void iterate_over_neighbours(mpm::Index id, Toper oper) const {
+    for (const auto slot : neighbours_.at(this->slot(id)))
+      for (const auto pid : this->range(slot)) oper(pid);
+  }
+
+ private:
+  //! Return slot of a cell
+  //! \param[in] id Cell id
+  unsigned slot(mpm::Index id) const {
+    const auto sitr = slots_.find(id);
+    if (sitr == slots_.end())
+      throw std::runtime_error("Cell is not present in the cell list");
+    return sitr->second;
+  }
+
+  //! Return particles of a slot
+  //! \param[in] slot Slot of a cell
+  Range range(unsigned slot) const {
+    return Range(particles_.data() + offsets_[slot],
+                 particles_.data() + offsets_[slot + 1]);
+  }
+
+  //! Slots of cells
+  tsl::robin_map<mpm::Index, unsigned> slots_;
+  //! Offsets of the particles of slots
+  std::vector<std::size_t> offsets_{0};
+  //! Particle ids of all slots
+  std::vector<mpm::Index> particles_;
+  //! Slots of a cell and its neighbours
+  std::vector<std::vector<unsigned>> neighbours_;
+};  // CellList class
+
+}  // namespace mpm
+
+#endif  // MPM_CELL_LIST_H_
@@ -7,6 +7,7 @@ mpm::ContactFriction<Tdim>::ContactFriction(
 //! Initialize nodal properties
 template <unsigned Tdim>
 inline void mpm::ContactFriction<Tdim>::initialise() {
+  mpm::ScopedTimer timer("contact");
   // Initialise nodal properties
   mesh_->initialise_nodal_properties();
 
@@ -19,6 +20,7 @@ inline void mpm::ContactFriction<Tdim>::initialise() {
 //! Compute contact forces
 template <unsigned Tdim>
 inline void mpm::ContactFriction<Tdim>::compute_contact_forces() {
+  mpm::ScopedTimer timer("contact");
 
   // Map multimaterial properties from particles to nodes
   mesh_->iterate_over_particles(std::bind(
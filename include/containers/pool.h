@@ -0,0 +1,155 @@
+#ifndef MPM_POOL_H_
+#define MPM_POOL_H_
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "Eigen/Core"
+
+#include "mutex.h"
+
+namespace mpm {
+
+// Pool class
+//! \brief A slab allocator that hands out fixed size slots
+//! \details Slots of the same size are carved out of contiguous slabs, which
+//! are never moved or released while the pool is alive, so an object placed in
+//! a slot has a stable address. Released slots are recycled through a free list
+//! of the corresponding slot size. Slots are aligned for fixed size
+//! vectorisable Eigen members.
+class Pool {
+ public:
+  //! Alignment of slots in bytes
+  static constexpr std::size_t alignment() {
+    return (EIGEN_MAX_ALIGN_BYTES > alignof(std::max_align_t))
+               ? EIGEN_MAX_ALIGN_BYTES
+               : alignof(std::max_align_t);
+  }
+
+  //! Constructor with number of slots per slab
+  //! \param[in] nslots_per_slab Number of slots allocated in one slab
+  explicit Pool(std::size_t nslots_per_slab = 1024);
+
+  //! Delete copy constructor
+  Pool(const Pool&) = delete;
+
+  //! Delete assignement operator
+  Pool& operator=(const Pool&) = delete;
+
+  //! Allocate a slot
+  //! \param[in] size Size of the object in bytes
+  //! \retval ptr Pointer to the uninitialised slot
+  void* allocate(std::size_t size);
+
+  //! Return a slot to the pool
+  //! \param[in] ptr Pointer to a slot obtained from allocate
+  //! \param[in] size Size of the object in bytes
+  void deallocate(void* ptr, std::size_t size);
+
+  //! Reserve free slots
+  //! \param[in] size Size of the object in bytes
+  //! \param[in] nslots Number of slots to be available without a new slab
+  void reserve(std::size_t size, std::size_t nslots);
+
+  //! Return the number of slots in use
+  std::size_t nallocated() const;
+
+  //! Return the number of free slots
+  std::size_t nfree() const;
+
+  //! Return the number of slabs
+  std::size_t nslabs() const;
+
+ private:
+  //! Slots of one size
+  struct Slots {
+    //! Contiguous blocks of memory, padded to align the first slot
+    std::vector<std::unique_ptr<char[]>> slabs;
+    //! Recycled and unused slots
+    std::vector<void*> free_slots;
+    //! Number of slots in use
+    std::size_t nallocated{0};
+  };
+
+  //! Round object size up to the slot alignment
+  //! \param[in] size Size of the object in bytes
+  static std::size_t slot_size(std::size_t size);
+
+  //! Append a slab to a slot list
+  //! \param[in] size Size of a slot in bytes
+  //! \param[in] slots Slot list
+  void add_slab(std::size_t size, Slots* slots);
+
+ private:
+  //! Number of slots per slab
+  std::size_t nslots_per_slab_{1024};
+  //! Slot lists indexed by slot size
+  std::map<std::size_t, Slots> slots_;
+  //! Mutex
+  mutable SpinMutex pool_mutex_;
+};  // Pool class
+
+// PoolAllocator class
+//! \brief A standard allocator which places single objects in a Pool
+//! \details Used with std::allocate_shared, the object and its control block
+//! share one pool slot, which is returned to the pool when the last shared
+//! pointer is released. Each allocator holds the pool, so the pool outlives
+//! every object allocated from it.
+//! \tparam T Type of the object
+template <typename T>
+class PoolAllocator {
+ public:
+  //! Value type
+  using value_type = T;
+
+  //! Constructor with a pool
+  //! \param[in] pool Memory pool
+  explicit PoolAllocator(const std::shared_ptr<Pool>& pool) : pool_{pool} {}
+
+  //! Rebind constructor
+  //! \param[in] allocator Allocator of a different type on the same pool
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U>& allocator) : pool_{allocator.pool()} {}
+
+  //! Allocate memory for n objects, single objects are placed in the pool
+  //! \param[in] n Number of objects
+  T* allocate(std::size_t n) {
+    if (n == 1) return static_cast<T*>(pool_->allocate(sizeof(T)));
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+
+  //! Release memory of n objects
+  //! \param[in] ptr Pointer to the memory
+  //! \param[in] n Number of objects
+  void deallocate(T* ptr, std::size_t n) {
+    if (n == 1)
+      pool_->deallocate(ptr, sizeof(T));
+    else
+      ::operator delete(ptr);
+  }
+
+  //! Return the memory pool
+  std::shared_ptr<Pool> pool() const { return pool_; }
+
+ private:
+  //! Memory pool
+  std::shared_ptr<Pool> pool_;
+};  // PoolAllocator class
+
+//! Allocators are equal if they share the same pool
+template <typename T, typename U>
+bool operator==(const PoolAllocator<T>& lhs, const PoolAllocator<U>& rhs) {
+  return lhs.pool() == rhs.pool();
+}
+
+//! Allocators are not equal if they use different pools
+template <typename T, typename U>
+bool operator!=(const PoolAllocator<T>& lhs, const PoolAllocator<U>& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace mpm
+#endif  // MPM_POOL_H_
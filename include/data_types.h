@@ -12,6 +12,15 @@ namespace mpm {
 //! Global index type for the node
 using Index = unsigned long long;
 
+//! Floating point type of particle shape function storage
+//! \details Single precision with USE_SINGLE_PRECISION_STORAGE halves the
+//! particle data streamed by P2G and G2P, arithmetic stays in double
+#ifdef USE_SINGLE_PRECISION_STORAGE
+using StorageReal = float;
+#else
+using StorageReal = double;
+#endif
+
 //! Return zero
 template <typename Ttype>
 Ttype zero();
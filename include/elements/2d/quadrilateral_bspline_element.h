@@ -0,0 +1,82 @@
+#ifndef MPM_QUADRILATERAL_BSPLINE_ELEMENT_H_
+#define MPM_QUADRILATERAL_BSPLINE_ELEMENT_H_
+
+#include <array>
+
+#include "bspline_kernel.h"
+#include "quadrilateral_gimp_element.h"
+
+namespace mpm {
+
+//! Quadrilateral B-spline element class derived from Quadrilateral GIMP
+//! \brief Quadrilateral quadratic / cubic B-spline element
+//! \details 16-noded quadrilateral B-spline element for structured Cartesian
+//! meshes, nodes are numbered as in the GIMP element. Functions of a node are
+//! products of the 1D B-spline of each axis, and are independent of the
+//! particle size. Nodes outside the support of a point have zero functions.
+//! \tparam Tdim Dimension
+//! \tparam Tnfunctions Number of functions
+//! \tparam Tpolynomial Polynomial degree of the B-spline (2 or 3)
+template <unsigned Tdim, unsigned Tnfunctions, unsigned Tpolynomial>
+class QuadrilateralBSplineElement
+    : public QuadrilateralGIMPElement<Tdim, Tnfunctions> {
+
+ public:
+  //! Define a vector of size dimension
+  using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+
+  //! constructor with number of shape functions
+  QuadrilateralBSplineElement()
+      : QuadrilateralGIMPElement<Tdim, Tnfunctions>() {
+    static_assert((Tpolynomial == 2 || Tpolynomial == 3),
+                  "Specified polynomial degree of B-spline is not defined");
+
+    //! Logger
+    std::string logger = "quadrilateral_bspline::<" + std::to_string(Tdim) +
+                         ", " + std::to_string(Tnfunctions) + ", " +
+                         std::to_string(Tpolynomial) + ">";
+    console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
+  }
+
+  //! Evaluate shape functions at given local coordinates
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval shapefn Shape function of a given cell
+  Eigen::VectorXd shapefn(const VectorDim& xi, const VectorDim& particle_size,
+                          const VectorDim& deformation_gradient) const override;
+
+  //! Evaluate gradient of shape functions
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval grad_shapefn Gradient of shape function of a given cell
+  Eigen::MatrixXd grad_shapefn(
+      const VectorDim& xi, const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const override;
+
+  //! Return the type of shape function
+  mpm::ShapefnType shapefn_type() const override {
+    return mpm::ShapefnType::BSPLINE;
+  }
+
+  //! Return if natural coordinates can be evaluates
+  bool isvalid_natural_coordinates_analytical() const override { return true; }
+
+  //! Compute Natural coordinates of a point (analytical)
+  //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
+  //! \param[in] point Location of the point in cell
+  //! \retval xi Return the local coordinates
+  VectorDim natural_coordinates_analytical(
+      const VectorDim& point,
+      const Eigen::MatrixXd& nodal_coordinates) const override;
+
+ private:
+  //! Logger
+  std::unique_ptr<spdlog::logger> console_;
+};
+
+}  // namespace mpm
+#include "quadrilateral_bspline_element.tcc"
+
+#endif  // MPM_QUADRILATERAL_BSPLINE_ELEMENT_H_
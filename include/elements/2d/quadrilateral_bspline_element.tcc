@@ -0,0 +1,84 @@
+//! Return shape functions of a 16-node Quadrilateral B-spline Element at a
+//! given local coordinate
+template <unsigned Tdim, unsigned Tnfunctions, unsigned Tpolynomial>
+inline Eigen::VectorXd
+    mpm::QuadrilateralBSplineElement<Tdim, Tnfunctions, Tpolynomial>::shapefn(
+        const Eigen::Matrix<double, Tdim, 1>& xi,
+        const Eigen::Matrix<double, Tdim, 1>& particle_size,
+        const Eigen::Matrix<double, Tdim, 1>& deformation_gradient) const {
+
+  //! To store shape functions
+  Eigen::Matrix<double, Tnfunctions, 1> shapefn;
+  //! Indices of nodes along each axis
+  static const auto indices = mpm::gimp::axis_indices<Tdim, Tnfunctions>(
+      this->natural_nodal_coordinates());
+
+  try {
+    //! 1D functions of the nodes along each axis
+    std::array<std::array<double, mpm::bspline::NAXIS_NODES>, Tdim> sn, dn;
+    for (unsigned i = 0; i < Tdim; ++i)
+      if (!mpm::bspline::axis_functions<Tpolynomial>(xi(i), &sn[i], &dn[i]))
+        throw std::runtime_error("B-spline shapefn: Invalid point location");
+
+    //! Tensor product of the 1D functions
+    for (unsigned n = 0; n < Tnfunctions; ++n) {
+      shapefn(n) = 1.;
+      for (unsigned i = 0; i < Tdim; ++i) shapefn(n) *= sn[i][indices[n][i]];
+    }
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    return shapefn;
+  }
+  return shapefn;
+}
+
+//! Return gradient of shape functions of a 16-node Quadrilateral B-spline
+//! Element at a given local coordinate
+template <unsigned Tdim, unsigned Tnfunctions, unsigned Tpolynomial>
+inline Eigen::MatrixXd
+    mpm::QuadrilateralBSplineElement<Tdim, Tnfunctions, Tpolynomial>::
+        grad_shapefn(
+            const Eigen::Matrix<double, Tdim, 1>& xi,
+            const Eigen::Matrix<double, Tdim, 1>& particle_size,
+            const Eigen::Matrix<double, Tdim, 1>& deformation_gradient) const {
+
+  //! To store grad shape functions
+  Eigen::Matrix<double, Tnfunctions, Tdim> grad_shapefn;
+  //! Indices of nodes along each axis
+  static const auto indices = mpm::gimp::axis_indices<Tdim, Tnfunctions>(
+      this->natural_nodal_coordinates());
+
+  try {
+    //! 1D functions and gradients of the nodes along each axis
+    std::array<std::array<double, mpm::bspline::NAXIS_NODES>, Tdim> sn, dn;
+    for (unsigned i = 0; i < Tdim; ++i)
+      if (!mpm::bspline::axis_functions<Tpolynomial>(xi(i), &sn[i], &dn[i]))
+        throw std::runtime_error(
+            "B-spline grad shapefn: Invalid point location");
+
+    //! Gradient along an axis times the functions of the other axes
+    for (unsigned n = 0; n < Tnfunctions; ++n) {
+      for (unsigned j = 0; j < Tdim; ++j) {
+        grad_shapefn(n, j) = dn[j][indices[n][j]];
+        for (unsigned i = 0; i < Tdim; ++i)
+          if (i != j) grad_shapefn(n, j) *= sn[i][indices[n][i]];
+      }
+    }
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    return grad_shapefn;
+  }
+  return grad_shapefn;
+}
+
+//! Compute natural coordinates of a point (analytical) from the corner nodes
+//! of the cell, which are the first 4 nodes of the element
+template <unsigned Tdim, unsigned Tnfunctions, unsigned Tpolynomial>
+inline Eigen::Matrix<double, Tdim, 1>
+    mpm::QuadrilateralBSplineElement<Tdim, Tnfunctions, Tpolynomial>::
+        natural_coordinates_analytical(
+            const VectorDim& point,
+            const Eigen::MatrixXd& nodal_coordinates) const {
+  return mpm::QuadrilateralElement<2, 4>::natural_coordinates_analytical(
+      point, nodal_coordinates.topRows(4));
+}
@@ -1,6 +1,9 @@
 #ifndef MPM_GIMP_ELEMENT_H_
 #define MPM_GIMP_ELEMENT_H_
 
+#include <array>
+
+#include "gimp_kernel.h"
 #include "quadrilateral_element.h"
 
 namespace mpm {
@@ -130,10 +133,11 @@ class QuadrilateralGIMPElement : public QuadrilateralElement<2, 4> {
       const VectorDim& point,
       const Eigen::MatrixXd& nodal_coordinates) const override;
 
- private:
+ protected:
   //! Return natural nodal coordinates
   Eigen::MatrixXd natural_nodal_coordinates() const;
 
+ private:
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
 };
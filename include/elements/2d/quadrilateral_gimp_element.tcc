@@ -34,52 +34,28 @@ inline Eigen::VectorXd
         const Eigen::Matrix<double, Tdim, 1>& particle_size,
         const Eigen::Matrix<double, Tdim, 1>& deformation_gradient) const {
 
-  //! length of element in local coordinate
-  const double element_length = 2.;
-  //! Natural nodal coordinates
-  const Eigen::Matrix<double, Tnfunctions, Tdim> local_nodes =
-      this->natural_nodal_coordinates();
   //! To store shape functions
   Eigen::Matrix<double, Tnfunctions, 1> shapefn;
+  //! Indices of nodes along each axis
+  static const auto indices = mpm::gimp::axis_indices<Tdim, Tnfunctions>(
+      this->natural_nodal_coordinates());
 
   try {
-    //! loop to iterate over nodes
+    //! 1D functions of the nodes along each axis
+    std::array<std::array<double, mpm::gimp::NAXIS_NODES>, Tdim> sn, dn;
+    for (unsigned i = 0; i < Tdim; ++i)
+      if (!mpm::gimp::axis_functions(xi(i), particle_size(i) * 0.5, &sn[i],
+                                     &dn[i]))
+        throw std::runtime_error(
+            "GIMP shapefn: Point location outside area of influence");
+
+    //! Tensor product of the 1D functions, see: Pruijn, N.S., 2016. Eq(4.30)
     for (unsigned n = 0; n < Tnfunctions; ++n) {
-      //! local shape function in current plane (x, y or z)
-      Eigen::Matrix<double, Tdim, 1> sni;
-      //! loop to iterate over dimensions
-      for (unsigned i = 0; i < Tdim; ++i) {
-        double lp = particle_size(i) * 0.5;
-        double ni = local_nodes(n, i);
-        double npni = xi(i) - ni;  // local particle  - local node
-        //! Conditional shape function statement see: Bardenhagen 2004
-        if (npni <= (-element_length - lp)) {
-          sni(i) = 0.;
-        } else if ((-element_length - lp) < npni &&
-                   npni <= (-element_length + lp)) {
-          sni(i) = std::pow(element_length + lp + npni, 2.) /
-                   (4. * (element_length * lp));
-        } else if ((-element_length + lp) < npni && npni <= -lp) {
-          sni(i) = 1. + (npni / element_length);
-        } else if (-lp < npni && npni <= lp) {
-          sni(i) =
-              1. - (((npni * npni) + (lp * lp)) / (2. * element_length * lp));
-        } else if (lp < npni && npni <= (element_length - lp)) {
-          sni(i) = 1. - (npni / element_length);
-        } else if ((element_length - lp) < npni &&
-                   npni <= element_length + lp) {
-          sni(i) = std::pow(element_length + lp - npni, 2.) /
-                   (4. * element_length * lp);
-        } else if ((element_length + lp) < npni) {
-          sni(i) = 0.;
-        } else {
-          throw std::runtime_error(
-              "GIMP shapefn: Point location outside area of influence");
-        }
-      }
-      shapefn(n) = sni(0) * sni(1);  // See: Pruijn, N.S., 2016. Eq(4.30)
+      shapefn(n) = 1.;
+      for (unsigned i = 0; i < Tdim; ++i) shapefn(n) *= sn[i][indices[n][i]];
     }
   } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
     return shapefn;
   }
   return shapefn;
@@ -94,62 +70,29 @@ inline Eigen::MatrixXd
         const Eigen::Matrix<double, Tdim, 1>& particle_size,
         const Eigen::Matrix<double, Tdim, 1>& deformation_gradient) const {
 
-  //! length of element in local coordinate
-  const double element_length = 2.;
-  //! Natural nodal coordinates
-  const Eigen::Matrix<double, Tnfunctions, Tdim> local_nodes =
-      this->natural_nodal_coordinates();
   //! To store grad shape functions
   Eigen::Matrix<double, Tnfunctions, Tdim> grad_shapefn;
+  //! Indices of nodes along each axis
+  static const auto indices = mpm::gimp::axis_indices<Tdim, Tnfunctions>(
+      this->natural_nodal_coordinates());
+
   try {
-    //! loop to iterate over nodes
+    //! 1D functions and gradients of the nodes along each axis
+    std::array<std::array<double, mpm::gimp::NAXIS_NODES>, Tdim> sn, dn;
+    for (unsigned i = 0; i < Tdim; ++i)
+      if (!mpm::gimp::axis_functions(xi(i), particle_size(i) * 0.5, &sn[i],
+                                     &dn[i]))
+        throw std::runtime_error(
+            "GIMP grad shapefn: Point location outside area of influence");
+
+    //! Gradient along an axis times the functions of the other axes
+    //! see: Pruijn, N.S., 2016. Eq(4.32)
     for (unsigned n = 0; n < Tnfunctions; ++n) {
-      //! local shape function in current plane (x, y or z)
-      Eigen::Matrix<double, Tdim, 1> sni;
-      //! local grad shape function in current plane (x, y or z)
-      Eigen::Matrix<double, Tdim, 1> dni;
-      //! loop to iterate over dimensions
-      for (unsigned i = 0; i < Tdim; ++i) {
-        double lp = particle_size(i) * 0.5;
-        double ni = local_nodes(n, i);
-        double npni = xi(i) - ni;  // local particle  - local node
-        //! Conditional shape function statement
-        // see: Pruijn, N.S., 2016. Eq(4.30)
-        if (npni <= (-element_length - lp)) {
-          sni(i) = 0.;
-          dni(i) = 0.;
-        } else if ((-element_length - lp) < npni &&
-                   npni <= (-element_length + lp)) {
-
-          sni(i) = std::pow(element_length + lp + npni, 2.) /
-                   (4. * (element_length * lp));
-          dni(i) = (element_length + lp + npni) / (2. * element_length * lp);
-        } else if ((-element_length + lp) < npni && npni <= -lp) {
-          sni(i) = 1. + (npni / element_length);
-          dni(i) = 1. / element_length;
-        } else if (-lp < npni && npni <= lp) {
-          sni(i) =
-              1. - (((npni * npni) + (lp * lp)) / (2. * element_length * lp));
-          dni(i) = -(npni / (element_length * lp));
-        } else if (lp < npni && npni <= (element_length - lp)) {
-          sni(i) = 1. - (npni / element_length);
-          dni(i) = -(1. / element_length);
-        } else if ((element_length - lp) < npni &&
-                   npni <= (element_length + lp)) {
-          sni(i) = std::pow(element_length + lp - npni, 2.) /
-                   (4. * element_length * lp);
-          dni(i) = -((element_length + lp - npni) / (2. * element_length * lp));
-        } else if ((element_length + lp) < npni) {
-          sni(i) = 0.;
-          dni(i) = 0.;
-        } else {
-          throw std::runtime_error(
-              "GIMP grad shapefn: Point location outside area of influence");
-        }
+      for (unsigned j = 0; j < Tdim; ++j) {
+        grad_shapefn(n, j) = dn[j][indices[n][j]];
+        for (unsigned i = 0; i < Tdim; ++i)
+          if (i != j) grad_shapefn(n, j) *= sn[i][indices[n][i]];
       }
-      // see: Pruijn, N.S., 2016. Eq(4.32)
-      grad_shapefn(n, 0) = dni(0) * sni(1);
-      grad_shapefn(n, 1) = dni(1) * sni(0);
     }
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
@@ -0,0 +1,70 @@
+#ifndef MPM_HEXAHEDRON_BSPLINE_ELEMENT_H_
+#define MPM_HEXAHEDRON_BSPLINE_ELEMENT_H_
+
+#include <array>
+
+#include "bspline_kernel.h"
+#include "hexahedron_gimp_element.h"
+
+namespace mpm {
+
+//! Hexahedron B-spline element class derived from Hexahedron GIMP
+//! \brief Hexahedron quadratic / cubic B-spline element
+//! \details 64-noded hexahedron B-spline element for structured Cartesian
+//! meshes, nodes are numbered as in the GIMP element. Functions of a node are
+//! products of the 1D B-spline of each axis, and are independent of the
+//! particle size. Nodes outside the support of a point have zero functions.
+//! \tparam Tdim Dimension
+//! \tparam Tnfunctions Number of functions
+//! \tparam Tpolynomial Polynomial degree of the B-spline (2 or 3)
+template <unsigned Tdim, unsigned Tnfunctions, unsigned Tpolynomial>
+class HexahedronBSplineElement
+    : public HexahedronGIMPElement<Tdim, Tnfunctions> {
+
+ public:
+  //! Define a vector of size dimension
+  using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+
+  //! constructor with number of shape functions
+  HexahedronBSplineElement() : HexahedronGIMPElement<Tdim, Tnfunctions>() {
+    static_assert((Tpolynomial == 2 || Tpolynomial == 3),
+                  "Specified polynomial degree of B-spline is not defined");
+
+    //! Logger
+    std::string logger = "hex_bspline::<" + std::to_string(Tdim) + ", " +
+                         std::to_string(Tnfunctions) + ", " +
+                         std::to_string(Tpolynomial) + ">";
+    console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
+  }
+
+  //! Evaluate shape functions at given local coordinates
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval shapefn Shape function of a given cell
+  Eigen::VectorXd shapefn(const VectorDim& xi, const VectorDim& particle_size,
+                          const VectorDim& deformation_gradient) const override;
+
+  //! Evaluate gradient of shape functions
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval grad_shapefn Gradient of shape function of a given cell
+  Eigen::MatrixXd grad_shapefn(
+      const VectorDim& xi, const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const override;
+
+  //! Return the type of shape function
+  mpm::ShapefnType shapefn_type() const override {
+    return mpm::ShapefnType::BSPLINE;
+  }
+
+ private:
+  //! Logger
+  std::unique_ptr<spdlog::logger> console_;
+};
+
+}  // namespace mpm
+#include "hexahedron_bspline_element.tcc"
+
+#endif  // MPM_HEXAHEDRON_BSPLINE_ELEMENT_H_
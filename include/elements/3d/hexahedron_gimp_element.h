@@ -1,6 +1,9 @@
 #ifndef MPM_GIMP_HEX_ELEMENT_H_
 #define MPM_GIMP_HEX_ELEMENT_H_
 
+#include <array>
+
+#include "gimp_kernel.h"
 #include "hexahedron_element.h"
 
 namespace mpm {
@@ -98,10 +101,11 @@ class HexahedronGIMPElement : public HexahedronElement<3, 8> {
   //! Return number of shape functions
   unsigned nfunctions() const override { return Tnfunctions; }
 
- private:
+ protected:
   //! Return natural nodal coordinates
   Eigen::MatrixXd natural_nodal_coordinates() const;
 
+ private:
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
 };
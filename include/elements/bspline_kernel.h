@@ -0,0 +1,73 @@
+#ifndef MPM_BSPLINE_KERNEL_H_
+#define MPM_BSPLINE_KERNEL_H_
+
+#include <array>
+#include <cmath>
+
+#include "gimp_kernel.h"
+
+namespace mpm {
+namespace bspline {
+
+//! Number of nodes of a B-spline element along an axis
+const unsigned NAXIS_NODES = mpm::gimp::NAXIS_NODES;
+
+//! Compute 1D B-spline functions and gradients of the nodes along an axis
+//! \details Nodes are at the natural coordinates -3, -1, 1 and 3 of a cell of
+//! length 2, as in a GIMP element. A quadratic B-spline spans 3 cells and a
+//! cubic B-spline 4 cells, so the 4 nodes along an axis cover the support of
+//! both, see: Steffen, M. et al., 2008. IJNME 76(6)
+//! \param[in] xi Natural coordinate of the point along the axis
+//! \param[out] sn Functions of the nodes along the axis
+//! \param[out] dn Gradients of the nodes along the axis
+//! \tparam Tpolynomial Polynomial degree of the B-spline (2 or 3)
+//! \retval status Point is a number
+template <unsigned Tpolynomial>
+inline bool axis_functions(double xi, std::array<double, NAXIS_NODES>* sn,
+                           std::array<double, NAXIS_NODES>* dn) {
+  static_assert((Tpolynomial == 2 || Tpolynomial == 3),
+                "B-spline of this polynomial degree is not defined");
+  if (std::isnan(xi)) return false;
+
+  //! Length of a cell in natural coordinates
+  const double element_length = 2.;
+  for (unsigned k = 0; k < NAXIS_NODES; ++k) {
+    //! Distance from the node in number of cells
+    const double r = (xi - (2. * k - 3.)) / element_length;
+    const double ar = std::fabs(r);
+    const double sign = (r < 0.) ? -1. : 1.;
+    double& s = (*sn)[k];
+    double& d = (*dn)[k];
+    if (Tpolynomial == 2) {
+      if (ar < 0.5) {
+        s = 0.75 - r * r;
+        d = -2. * r;
+      } else if (ar < 1.5) {
+        s = 0.5 * (1.5 - ar) * (1.5 - ar);
+        d = -sign * (1.5 - ar);
+      } else {
+        s = 0.;
+        d = 0.;
+      }
+    } else {
+      if (ar < 1.) {
+        s = 2. / 3. - r * r + 0.5 * ar * ar * ar;
+        d = -2. * r + 1.5 * r * ar;
+      } else if (ar < 2.) {
+        s = (2. - ar) * (2. - ar) * (2. - ar) / 6.;
+        d = -sign * 0.5 * (2. - ar) * (2. - ar);
+      } else {
+        s = 0.;
+        d = 0.;
+      }
+    }
+    // Gradient with respect to the natural coordinate
+    d /= element_length;
+  }
+  return true;
+}
+
+}  // namespace bspline
+}  // namespace mpm
+
+#endif  // MPM_BSPLINE_KERNEL_H_
@@ -17,7 +17,7 @@ namespace mpm {
 enum ElementDegree { Linear = 1, Quadratic = 2 };
 
 // Element Shapefn
-enum ShapefnType { NORMAL_MPM = 1, GIMP = 2, CPDI = 3 };
+enum ShapefnType { NORMAL_MPM = 1, GIMP = 2, CPDI = 3, BSPLINE = 4 };
 
 //! Base class of shape functions
 //! \brief Base class that stores the information about shape functions
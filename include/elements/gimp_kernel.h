@@ -0,0 +1,81 @@
+#ifndef MPM_GIMP_KERNEL_H_
+#define MPM_GIMP_KERNEL_H_
+
+#include <array>
+#include <cmath>
+
+#include "Eigen/Dense"
+
+namespace mpm {
+namespace gimp {
+
+//! Number of nodes of a GIMP element along an axis
+const unsigned NAXIS_NODES = 4;
+
+//! Compute 1D GIMP functions and gradients of the nodes along an axis
+//! \details Nodes are at the natural coordinates -3, -1, 1 and 3 of a cell of
+//! length 2, see: Bardenhagen 2004 and Pruijn, N.S., 2016. Eq(4.30)
+//! \param[in] xi Natural coordinate of the particle along the axis
+//! \param[in] lp Half of the particle size along the axis
+//! \param[out] sn Functions of the nodes along the axis
+//! \param[out] dn Gradients of the nodes along the axis
+//! \retval status Point is in the area of influence of the nodes
+inline bool axis_functions(double xi, double lp,
+                           std::array<double, NAXIS_NODES>* sn,
+                           std::array<double, NAXIS_NODES>* dn) {
+  //! length of element in local coordinate
+  const double element_length = 2.;
+  for (unsigned k = 0; k < NAXIS_NODES; ++k) {
+    const double npni = xi - (2. * k - 3.);  // local particle  - local node
+    double& s = (*sn)[k];
+    double& d = (*dn)[k];
+    if (npni <= (-element_length - lp)) {
+      s = 0.;
+      d = 0.;
+    } else if (npni <= (-element_length + lp)) {
+      const double distance = element_length + lp + npni;
+      s = (distance * distance) / (4. * element_length * lp);
+      d = distance / (2. * element_length * lp);
+    } else if (npni <= -lp) {
+      s = 1. + (npni / element_length);
+      d = 1. / element_length;
+    } else if (npni <= lp) {
+      s = 1. - (((npni * npni) + (lp * lp)) / (2. * element_length * lp));
+      d = -(npni / (element_length * lp));
+    } else if (npni <= (element_length - lp)) {
+      s = 1. - (npni / element_length);
+      d = -(1. / element_length);
+    } else if (npni <= (element_length + lp)) {
+      const double distance = element_length + lp - npni;
+      s = (distance * distance) / (4. * element_length * lp);
+      d = -distance / (2. * element_length * lp);
+    } else if ((element_length + lp) < npni) {
+      s = 0.;
+      d = 0.;
+    } else {
+      // Not a number
+      return false;
+    }
+  }
+  return true;
+}
+
+//! Indices of nodes along each axis from their natural coordinates
+//! \param[in] local_nodes Natural nodal coordinates of a GIMP element
+//! \tparam Tdim Dimension
+//! \tparam Tnfunctions Number of functions
+template <unsigned Tdim, unsigned Tnfunctions>
+inline std::array<std::array<unsigned, Tdim>, Tnfunctions> axis_indices(
+    const Eigen::MatrixXd& local_nodes) {
+  std::array<std::array<unsigned, Tdim>, Tnfunctions> indices;
+  for (unsigned n = 0; n < Tnfunctions; ++n)
+    for (unsigned i = 0; i < Tdim; ++i)
+      indices[n][i] =
+          static_cast<unsigned>(std::lround((local_nodes(n, i) + 3.) * 0.5));
+  return indices;
+}
+
+}  // namespace gimp
+}  // namespace mpm
+
+#endif  // MPM_GIMP_KERNEL_H_
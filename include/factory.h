@@ -8,6 +8,8 @@
 #include <string>
 #include <vector>
 
+#include "pool.h"
+
 //! \brief Singleton factory implementation
 //! \tparam Tbaseclass Base class
 //! \tparam Targs variadic template arguments
@@ -39,6 +41,20 @@ class Factory {
     return registry.at(key)->create(std::forward<Targs>(args)...);
   }
 
+  //! Create an instance of a registered class in a memory pool
+  //! \param[in] key key to item in registry
+  //! \param[in] allocator Pool allocator of the instance
+  //! \param[in] args Variadic template arguments
+  //! \retval shared_ptr<Tbaseclass> Shared pointer to a base class
+  std::shared_ptr<Tbaseclass> create(
+      const std::string& key, const mpm::PoolAllocator<Tbaseclass>& allocator,
+      Targs&&... args) {
+    if (!this->check(key))
+      throw std::runtime_error("Invalid key: " + key +
+                               ", not found in the factory register!");
+    return registry.at(key)->create(allocator, std::forward<Targs>(args)...);
+  }
+
   //! Check if an element is registered
   //! \param[in] key Key to be checked in registry
   //! \retval status Return if key is in registry or not
@@ -57,6 +73,9 @@ class Factory {
   struct CreatorBase {
     //! A virtual create function
     virtual std::shared_ptr<Tbaseclass> create(Targs&&...) = 0;
+    //! A virtual create function using a pool allocator
+    virtual std::shared_ptr<Tbaseclass> create(
+        const mpm::PoolAllocator<Tbaseclass>&, Targs&&...) = 0;
   };
 
   //! Creator class
@@ -67,6 +86,14 @@ class Factory {
     std::shared_ptr<Tbaseclass> create(Targs&&... args) override {
       return std::make_shared<Tderivedclass>(std::forward<Targs>(args)...);
     }
+    //! Create instance of object in a memory pool
+    std::shared_ptr<Tbaseclass> create(
+        const mpm::PoolAllocator<Tbaseclass>& allocator,
+        Targs&&... args) override {
+      return std::allocate_shared<Tderivedclass>(
+          mpm::PoolAllocator<Tderivedclass>(allocator),
+          std::forward<Targs>(args)...);
+    }
   };
   // Register of factory functions
   std::map<std::string, std::shared_ptr<CreatorBase>> registry;
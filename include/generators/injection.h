@@ -16,6 +16,10 @@ struct Injection {
   double end_time{std::numeric_limits<double>::max()};
   // Particle velocity
   std::vector<double> velocity;
+  // Volumetric flow rate, zero fills all empty cells
+  double flow_rate{0.};
+  // Volume injected over all ranks
+  double injected_volume{0.};
 };
 }  // namespace mpm
 
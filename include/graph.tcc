@@ -141,53 +141,38 @@ std::vector<mpm::Index> mpm::Graph<Tdim>::collect_partitions(int mpi_size,
   //! allocate space to partition
   mpm::Index ncells = this->cells_.size();
   std::vector<mpm::Index> partition(ncells, 0);
-  // ID of cells, which should transfer particles
-  std::vector<mpm::Index> exchange_cells;
-  if (mpi_rank == 0) {
-    int par = 0;
-    for (int i = 0; i < this->vtxdist_[1]; ++i) {
-      partition[par] = this->part_[i];
-      par = par + 1;
-    }
-
-    for (int penum = 1; penum < mpi_size; ++penum) {
-      idxtype rnvtxs = this->vtxdist_[penum + 1] - this->vtxdist_[penum];
-      std::vector<idxtype> rpart(rnvtxs);
-      //! penum is the source process
-      MPI_Recv(rpart.data(), rnvtxs, MPI_UNSIGNED_LONG_LONG, penum, 1, *comm,
-               MPI_STATUS_IGNORE);
-
-      for (int i = 0; i < rnvtxs; ++i) {
-        partition[par] = rpart[i];
-        par = par + 1;
-      }
-    }
 
-    for (int penum = 1; penum < mpi_size; ++penum)
-      MPI_Send(partition.data(), ncells, MPI_UNSIGNED_LONG_LONG, penum, 1,
-               *comm);
-
-  } else {
-    MPI_Send(this->part_.data(),
-             this->vtxdist_[mpi_rank + 1] - this->vtxdist_[mpi_rank],
-             MPI_UNSIGNED_LONG_LONG, 0, 1, *comm);
-    MPI_Recv(partition.data(), ncells, MPI_UNSIGNED_LONG_LONG, 0, 1, *comm,
-             MPI_STATUS_IGNORE);
+  // Gather the partition of the cells of every rank on all ranks
+  std::vector<int> counts(mpi_size), displacements(mpi_size);
+  for (int penum = 0; penum < mpi_size; ++penum) {
+    displacements[penum] = this->vtxdist_[penum];
+    counts[penum] = this->vtxdist_[penum + 1] - this->vtxdist_[penum];
   }
-
-  // Assign partition to cells
-  for (auto citr = this->cells_.cbegin(); citr != this->cells_.cend(); ++citr) {
-    auto current_rank = partition[(*citr)->id()];
-    auto previous_rank = (*citr)->rank();
+  MPI_Allgatherv(this->part_.data(), counts[mpi_rank], MPI_UNSIGNED_LONG_LONG,
+                 partition.data(), counts.data(), displacements.data(),
+                 MPI_UNSIGNED_LONG_LONG, *comm);
+
+  // Assign partition to cells and flag cells, which should transfer particles
+  const long nvector = this->cells_.size();
+  std::vector<char> exchange(nvector, 0);
+#pragma omp parallel for schedule(runtime)
+  for (long i = 0; i < nvector; ++i) {
+    const auto cell = this->cells_[i];
+    auto current_rank = partition[cell->id()];
+    auto previous_rank = cell->rank();
     // If the current rank is different from cell rank
     if (current_rank != previous_rank) {
       // Assign current MPI rank
-      (*citr)->rank(current_rank);
+      cell->rank(current_rank);
       // Add cell id to list of cells to transfer particles if there are
       // particles
-      if ((*citr)->nglobal_particles() > 0)
-        exchange_cells.emplace_back((*citr)->id());
+      if (cell->nglobal_particles() > 0) exchange[i] = 1;
     }
   }
+
+  // ID of cells, which should transfer particles, in the order of cells
+  std::vector<mpm::Index> exchange_cells;
+  for (long i = 0; i < nvector; ++i)
+    if (exchange[i]) exchange_cells.emplace_back(this->cells_[i]->id());
   return exchange_cells;
 }
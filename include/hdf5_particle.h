@@ -1,6 +1,9 @@
 #ifndef MPM_HDF5_H_
 #define MPM_HDF5_H_
 
+#include <string>
+#include <vector>
+
 // HDF5
 #include "hdf5.h"
 #include "hdf5_hl.h"
@@ -64,6 +67,76 @@ extern const char* field_names[NFIELDS];
 // Initialize field types
 extern const hid_t field_type[NFIELDS];
 
+//! Version of the compact particle table schema
+const int SCHEMA_VERSION = 2;
+
+//! Maximum number of state variables in a particle record
+const unsigned NSTATE_VARS = 20;
+
+// CompactLayout class
+//! \brief Packed particle record with only the fields of a dimension
+//! \details The record holds the components of vectors and tensors that exist
+//! in the dimension and nstate_vars state variables. Fields are packed without
+//! padding and map to the HDF5Particle fields of the full table.
+class CompactLayout {
+ public:
+  //! Constructor with dimension and number of state variables
+  //! \param[in] dim Dimension
+  //! \param[in] nstate_vars Number of state variables
+  //! \param[in] single_precision Store real fields as float
+  CompactLayout(unsigned dim, unsigned nstate_vars,
+                bool single_precision = false);
+
+  //! Pack particle data in a record
+  //! \param[in] particle HDF5 particle data
+  //! \param[in] record Pointer to the record
+  void pack(const HDF5Particle& particle, char* record) const;
+
+  //! Unpack a record to particle data
+  //! \param[in] record Pointer to the record
+  //! \param[in] particle HDF5 particle data
+  void unpack(const char* record, HDF5Particle* particle) const;
+
+  //! Number of fields
+  hsize_t nfields() const { return fields_.size(); }
+
+  //! Size of a record in bytes
+  size_t record_size() const { return record_size_; }
+
+  //! Offsets of the fields in a record
+  const size_t* offsets() const { return offsets_.data(); }
+
+  //! Sizes of the fields
+  const size_t* sizes() const { return sizes_.data(); }
+
+  //! Names of the fields
+  const char** field_names() { return names_.data(); }
+
+  //! Types of the fields
+  const hid_t* field_types() const { return types_.data(); }
+
+  //! Size of real fields in bytes
+  unsigned real_size() const { return real_size_; }
+
+ private:
+  //! Size of a record
+  size_t record_size_{0};
+  //! Size of real fields
+  unsigned real_size_{sizeof(double)};
+  //! Fields stored as float
+  std::vector<bool> narrowed_;
+  //! Indices of the fields in the full particle table
+  std::vector<unsigned> fields_;
+  //! Offsets of the fields in a record
+  std::vector<size_t> offsets_;
+  //! Sizes of the fields
+  std::vector<size_t> sizes_;
+  //! Names of the fields
+  std::vector<const char*> names_;
+  //! Types of the fields
+  std::vector<hid_t> types_;
+};  // CompactLayout class
+
 }  // namespace particle
 }  // namespace hdf5
 
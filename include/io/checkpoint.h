@@ -0,0 +1,99 @@
+#ifndef MPM_CHECKPOINT_H_
+#define MPM_CHECKPOINT_H_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "json.hpp"
+
+#include "data_types.h"
+#include "hdf5_particle.h"
+
+using Json = nlohmann::json;
+
+namespace mpm {
+
+// Checkpoint class
+//! \brief Restart checkpoints of particles with full and delta snapshots
+//! \details Every full_interval checkpoints a full snapshot stores all the
+//! particles. A delta snapshot stores, for each group of fields, the values
+//! and the indices of the particles whose fields changed since the previous
+//! checkpoint, and the particle ids when particles are added, removed or
+//! reordered. Fields required to restart are compared exactly. Output only
+//! fields, i.e., pressure, displacements, strains and volumetric strain, are
+//! stored when they differ from their checkpointed value by more than the
+//! tolerance. A step is reconstructed from the last full snapshot and the
+//! delta snapshots up to the step.
+class Checkpoint {
+ public:
+  //! Constructor with checkpoint properties
+  //! \param[in] props Number of checkpoints between full snapshots
+  //! "full_interval" and tolerance of output only fields "tolerance"
+  explicit Checkpoint(const Json& props);
+
+  //! Write the checkpoint of a step
+  //! \param[in] filename Name of the HDF5 checkpoint file
+  //! \param[in] step Step of the checkpoint
+  //! \param[in] particles Particles of the step
+  //! \retval full Checkpoint is a full snapshot
+  bool write(const std::string& filename, mpm::Index step,
+             const std::vector<HDF5Particle>& particles);
+
+  //! Reconstruct the particles of a step
+  //! \param[in] filename Name of the HDF5 checkpoint file of a step
+  //! \param[in] step Step to reconstruct
+  //! \retval particles Particles of the step
+  static std::vector<HDF5Particle> read(
+      const std::function<std::string(mpm::Index)>& filename,
+      mpm::Index step);
+
+  //! Return the step of the last full snapshot at or before a step
+  //! \param[in] filename Name of the HDF5 checkpoint file of a step
+  //! \param[in] step Step of a checkpoint
+  //! \retval full_step Step of the full snapshot of the checkpoint
+  static mpm::Index full_step(
+      const std::function<std::string(mpm::Index)>& filename,
+      mpm::Index step);
+
+  //! Return the number of checkpoints between full snapshots
+  unsigned full_interval() const { return full_interval_; }
+
+  //! Return the tolerance of output only fields
+  double tolerance() const { return tolerance_; }
+
+ private:
+  //! Return the steps of the checkpoints from a step back to its full
+  //! snapshot
+  //! \param[in] filename Name of the HDF5 checkpoint file of a step
+  //! \param[in] step Step of a checkpoint
+  //! \retval steps Steps of the checkpoints, ending with the full snapshot
+  static std::vector<mpm::Index> snapshot_steps(
+      const std::function<std::string(mpm::Index)>& filename,
+      mpm::Index step);
+
+  //! Apply a checkpoint to the particles of the previous checkpoint
+  //! \param[in] file Name of the HDF5 checkpoint file
+  //! \param[in] reference Particles of the previous checkpoint, empty for a
+  //! full snapshot
+  //! \retval particles Particles of the checkpoint
+  static std::vector<HDF5Particle> read_snapshot(
+      const std::string& file, std::vector<HDF5Particle> reference);
+
+  //! Number of checkpoints between full snapshots
+  unsigned full_interval_{10};
+  //! Tolerance of output only fields
+  double tolerance_{0.};
+  //! Number of delta snapshots since the last full snapshot
+  unsigned ndeltas_{0};
+  //! A checkpoint has been written
+  bool written_{false};
+  //! Step of the previous checkpoint
+  mpm::Index previous_step_{0};
+  //! Particles as reconstructed from the previous checkpoint
+  std::vector<HDF5Particle> reference_;
+};
+
+}  // namespace mpm
+
+#endif  // MPM_CHECKPOINT_H_
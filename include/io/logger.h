@@ -41,6 +41,9 @@ struct Logger {
 
   // Create a logger for MPM Explicit USL
   static const std::shared_ptr<spdlog::logger> mpm_explicit_usl_logger;
+
+  // Create a logger for MPM Implicit
+  static const std::shared_ptr<spdlog::logger> mpm_implicit_logger;
 };
 
 }  // namespace mpm
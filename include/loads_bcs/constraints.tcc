@@ -5,7 +5,7 @@ bool mpm::Constraints<Tdim>::assign_nodal_velocity_constraint(
   bool status = true;
   try {
     int set_id = vconstraint->setid();
-    auto nset = mesh_->nodes(set_id);
+    const auto& nset = mesh_->nodes(set_id);
     if (nset.size() == 0)
       throw std::runtime_error(
           "Node set is empty for assignment of velocity constraints");
@@ -58,7 +58,7 @@ bool mpm::Constraints<Tdim>::assign_nodal_frictional_constraint(
   bool status = true;
   try {
     int set_id = fconstraint->setid();
-    auto nset = mesh_->nodes(set_id);
+    const auto& nset = mesh_->nodes(set_id);
     if (nset.size() == 0)
       throw std::runtime_error(
           "Node set is empty for assignment of velocity constraints");
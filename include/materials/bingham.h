@@ -20,6 +20,8 @@ class Bingham : public Material<Tdim> {
   using Vector6d = Eigen::Matrix<double, 6, 1>;
   //! Define a Matrix of 6 x 6
   using Matrix6x6 = Eigen::Matrix<double, 6, 6>;
+  //! Define a Matrix of 6 x n
+  using Matrix6X = Eigen::Matrix<double, 6, Eigen::Dynamic>;
 
   //! Constructor with id and material properties
   //! \param[in] id Material ID
@@ -52,6 +54,16 @@ class Bingham : public Material<Tdim> {
                           const ParticleBase<Tdim>* ptr,
                           mpm::dense_map* state_vars) override;
 
+  //! Compute stresses of a batch of particles sharing the material
+  //! \param[in,out] stresses Stresses of particles, one column per particle
+  //! \param[in] dstrains Strain increments, one column per particle
+  //! \param[in] particles Constant pointers to particles
+  //! \param[in] state_vars History-dependent state variables of particles
+  void compute_stresses(
+      Matrix6X* stresses, const Matrix6X& dstrains,
+      const std::vector<const ParticleBase<Tdim>*>& particles,
+      const std::vector<mpm::dense_map*>& state_vars) override;
+
  protected:
   //! material id
   using Material<Tdim>::id_;
@@ -112,6 +112,61 @@ Eigen::Matrix<double, 6, 1> mpm::Bingham<Tdim>::compute_stress(
   return updated_stress;
 }
 
+//! Compute stresses of a batch of particles
+template <unsigned Tdim>
+void mpm::Bingham<Tdim>::compute_stresses(
+    Matrix6X* stresses, const Matrix6X& dstrains,
+    const std::vector<const ParticleBase<Tdim>*>& particles,
+    const std::vector<mpm::dense_map*>& state_vars) {
+  const unsigned nparticles = particles.size();
+
+  // Gather strain rates and update pressures
+  Matrix6X strain_rates(6, nparticles);
+  Eigen::RowVectorXd pressures(nparticles);
+  for (unsigned i = 0; i < nparticles; ++i) {
+    strain_rates.col(i) = particles[i]->strain_rate();
+    double& pressure = (*state_vars[i]).at("pressure");
+    pressure += (compressibility_multiplier_ *
+                 this->thermodynamic_pressure(
+                     particles[i]->dvolumetric_strain()));
+    pressures(i) = pressure;
+  }
+
+  // Convert strain rate to rate of deformation tensor
+  strain_rates.bottomRows(3) *= 0.5;
+
+  // Set threshold for minimum critical shear rate
+  const double shear_rate_threshold = 1.0E-15;
+  if (critical_shear_rate_ < shear_rate_threshold)
+    critical_shear_rate_ = shear_rate_threshold;
+
+  // Rate of shear = sqrt(2 * D_ij * D_ij)
+  const Eigen::ArrayXXd shear_rates =
+      (2. * (strain_rates.colwise().squaredNorm() +
+             strain_rates.bottomRows(3).colwise().squaredNorm()))
+          .array()
+          .sqrt();
+
+  // Apparent viscosity of yielded particles
+  const Eigen::ArrayXXd apparent_viscosity =
+      (shear_rates.square() > critical_shear_rate_ * critical_shear_rate_)
+          .select(2. * ((tau0_ / shear_rates) + mu_), 0.);
+
+  // Deviatoric part of cauchy stress tensor
+  Matrix6X tau =
+      (strain_rates.array().rowwise() * apparent_viscosity.row(0)).matrix();
+
+  // von Mises criterion
+  const Eigen::ArrayXXd trace_invariant2 =
+      0.5 * tau.topRows(3).colwise().squaredNorm().array();
+  for (unsigned i = 0; i < nparticles; ++i)
+    if (trace_invariant2(0, i) < (tau0_ * tau0_)) tau.col(i).setZero();
+
+  // Update volumetric and deviatoric stress
+  stresses->noalias() =
+      -compressibility_multiplier_ * this->dirac_delta() * pressures + tau;
+}
+
 //! Dirac delta 2D
 template <>
 inline Eigen::Matrix<double, 6, 1> mpm::Bingham<2>::dirac_delta() const {
@@ -50,3 +50,13 @@ Eigen::Matrix<double, 6, 1> mpm::LinearElastic<Tdim>::compute_stress(
   const Vector6d dstress = this->de_ * dstrain;
   return (stress + dstress);
 }
+
+//! Compute stresses of a batch of particles
+template <unsigned Tdim>
+void mpm::LinearElastic<Tdim>::compute_stresses(
+    Matrix6X* stresses, const Matrix6X& dstrains,
+    const std::vector<const ParticleBase<Tdim>*>& particles,
+    const std::vector<mpm::dense_map*>& state_vars) {
+  // Stress increments of all particles in a single product
+  stresses->noalias() += this->de_ * dstrains;
+}
@@ -1,7 +1,9 @@
 #ifndef MPM_MATERIAL_MATERIAL_H_
 #define MPM_MATERIAL_MATERIAL_H_
 
+#include <atomic>
 #include <limits>
+#include <map>
 
 #include "Eigen/Dense"
 #include "json.hpp"
@@ -33,6 +35,8 @@ class Material {
   using Vector6d = Eigen::Matrix<double, 6, 1>;
   //! Define a Matrix of 6 x 6
   using Matrix6x6 = Eigen::Matrix<double, 6, 6>;
+  //! Define a Matrix of 6 x n
+  using Matrix6X = Eigen::Matrix<double, 6, Eigen::Dynamic>;
 
   // Constructor with id
   //! \param[in] id Material id
@@ -61,6 +65,13 @@ class Material {
   template <typename Ttype>
   Ttype property(const std::string& key);
 
+  //! Check if a material property is defined
+  //! \param[in] key Material property key
+  //! \retval status Material property is defined
+  bool has_property(const std::string& key) const {
+    return properties_.find(key) != properties_.end();
+  }
+
   //! Initialise history variables
   virtual mpm::dense_map initialise_state_variables() = 0;
 
@@ -78,13 +89,86 @@ class Material {
                                   const ParticleBase<Tdim>* ptr,
                                   mpm::dense_map* state_vars) = 0;
 
+  //! Compute trial stress of an implicit iteration, which is not counted in
+  //! the statistics of stress updates
+  //! \param[in] stress Stress
+  //! \param[in] dstrain Strain
+  //! \param[in] particle Constant point to particle base
+  //! \param[in] state_vars History-dependent state variables
+  //! \retval updated_stress Trial value of stress
+  virtual Vector6d compute_trial_stress(const Vector6d& stress,
+                                        const Vector6d& dstrain,
+                                        const ParticleBase<Tdim>* ptr,
+                                        mpm::dense_map* state_vars) {
+    return this->compute_stress(stress, dstrain, ptr, state_vars);
+  }
+
+  //! Compute stresses of a batch of particles sharing the material
+  //! \param[in,out] stresses Stresses of particles, one column per particle
+  //! \param[in] dstrains Strain increments, one column per particle
+  //! \param[in] particles Constant pointers to particles
+  //! \param[in] state_vars History-dependent state variables of particles
+  virtual void compute_stresses(
+      Matrix6X* stresses, const Matrix6X& dstrains,
+      const std::vector<const ParticleBase<Tdim>*>& particles,
+      const std::vector<mpm::dense_map*>& state_vars);
+
+  //! Return statistics of stress updates
+  //! \retval statistics Number of updates, return-mapping iterations,
+  //! substeps and non-converged updates
+  std::map<std::string, unsigned long long> statistics() const {
+    return {{"nupdates", nupdates_},
+            {"niterations", niterations_},
+            {"nsubsteps", nsubsteps_},
+            {"nnonconverged", nnonconverged_}};
+  }
+
+  //! Reset statistics of stress updates
+  void reset_statistics() {
+    nupdates_ = 0;
+    niterations_ = 0;
+    nsubsteps_ = 0;
+    nnonconverged_ = 0;
+  }
+
+  //! Statistics of stress updates accumulated by a thread
+  struct UpdateStatistics {
+    //! Number of stress updates
+    unsigned long long nupdates{0};
+    //! Number of return-mapping iterations
+    unsigned long long niterations{0};
+    //! Number of substeps
+    unsigned long long nsubsteps{0};
+    //! Number of stress updates that did not converge
+    unsigned long long nnonconverged{0};
+  };
+
  protected:
+  //! Add statistics accumulated locally to the statistics of the material
+  //! \param[in] statistics Statistics of a stress update or of a batch
+  void add_statistics(const UpdateStatistics& statistics) {
+    nupdates_ += statistics.nupdates;
+    niterations_ += statistics.niterations;
+    nsubsteps_ += statistics.nsubsteps;
+    nnonconverged_ += statistics.nnonconverged;
+  }
+
   //! material id
   unsigned id_{std::numeric_limits<unsigned>::max()};
   //! Material properties
   Json properties_;
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
+
+ private:
+  //! Number of stress updates
+  std::atomic<unsigned long long> nupdates_{0};
+  //! Number of return-mapping iterations
+  std::atomic<unsigned long long> niterations_{0};
+  //! Number of substeps
+  std::atomic<unsigned long long> nsubsteps_{0};
+  //! Number of stress updates that did not converge
+  std::atomic<unsigned long long> nnonconverged_{0};
 };  // Material class
 }  // namespace mpm
 
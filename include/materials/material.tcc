@@ -11,3 +11,14 @@ Ttype mpm::Material<Tdim>::property(const std::string& key) {
         "Property call to material parameter not found or invalid type");
   }
 }
+
+//! Compute stresses of a batch of particles one particle at a time
+template <unsigned Tdim>
+void mpm::Material<Tdim>::compute_stresses(
+    Matrix6X* stresses, const Matrix6X& dstrains,
+    const std::vector<const ParticleBase<Tdim>*>& particles,
+    const std::vector<mpm::dense_map*>& state_vars) {
+  for (unsigned i = 0; i < particles.size(); ++i)
+    stresses->col(i) = this->compute_stress(stresses->col(i), dstrains.col(i),
+                                            particles[i], state_vars[i]);
+}
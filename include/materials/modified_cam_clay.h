@@ -21,6 +21,10 @@ class ModifiedCamClay : public Material<Tdim> {
   using Vector6d = Eigen::Matrix<double, 6, 1>;
   //! Define a Matrix of 6 x 6
   using Matrix6x6 = Eigen::Matrix<double, 6, 6>;
+  //! Define a Matrix of 6 x n
+  using Matrix6X = Eigen::Matrix<double, 6, Eigen::Dynamic>;
+  //! Statistics of stress updates
+  using UpdateStatistics = typename Material<Tdim>::UpdateStatistics;
 
   //! Failure state
   enum FailureState { Elastic = 0, Yield = 1 };
@@ -55,6 +59,29 @@ class ModifiedCamClay : public Material<Tdim> {
                           const ParticleBase<Tdim>* ptr,
                           mpm::dense_map* state_vars) override;
 
+  //! Compute trial stress of an implicit iteration, which is not counted in
+  //! the statistics of stress updates
+  //! \param[in] stress Stress
+  //! \param[in] dstrain Strain
+  //! \param[in] particle Constant point to particle base
+  //! \param[in] state_vars History-dependent state variables
+  //! \retval updated_stress Trial value of stress
+  Vector6d compute_trial_stress(const Vector6d& stress,
+                                const Vector6d& dstrain,
+                                const ParticleBase<Tdim>* ptr,
+                                mpm::dense_map* state_vars) override;
+
+  //! Compute stresses of a batch of particles sharing the material, with
+  //! the statistics of the batch added once
+  //! \param[in,out] stresses Stresses of particles, one column per particle
+  //! \param[in] dstrains Strain increments, one column per particle
+  //! \param[in] particles Constant pointers to particles
+  //! \param[in] state_vars History-dependent state variables of particles
+  void compute_stresses(
+      Matrix6X* stresses, const Matrix6X& dstrains,
+      const std::vector<const ParticleBase<Tdim>*>& particles,
+      const std::vector<mpm::dense_map*>& state_vars) override;
+
   //! Compute stress invariants (j3, q, theta, and epsilon)
   //! \param[in] stress Stress
   //! \param[in] state_vars History-dependent state variables
@@ -126,6 +153,28 @@ class ModifiedCamClay : public Material<Tdim> {
   //! Logger
   using Material<Tdim>::console_;
 
+ private:
+  //! Update stress and accumulate the statistics of the update
+  //! \param[in] stress Stress
+  //! \param[in] dstrain Strain
+  //! \param[in] state_vars History-dependent state variables
+  //! \param[in,out] statistics Statistics of stress updates
+  //! \retval updated_stress Updated value of stress
+  Vector6d update_stress(const Vector6d& stress, const Vector6d& dstrain,
+                         mpm::dense_map* state_vars,
+                         UpdateStatistics* statistics);
+
+  //! Closest point return mapping of a strain increment
+  //! \param[in] stress Stress
+  //! \param[in] dstrain Strain
+  //! \param[in] state_vars History-dependent state variables
+  //! \param[in] converged Convergence status of the return mapping
+  //! \param[in,out] statistics Statistics of stress updates
+  //! \retval updated_stress Updated value of stress
+  Vector6d return_mapping(const Vector6d& stress, const Vector6d& dstrain,
+                          mpm::dense_map* state_vars, bool* converged,
+                          UpdateStatistics* statistics);
+
  private:
   //! Elastic stiffness matrix
   Matrix6x6 de_;
@@ -179,6 +228,17 @@ class ModifiedCamClay : public Material<Tdim> {
   double m_shear_ = {std::numeric_limits<double>::epsilon()};
   //! Hydrate saturation
   double s_h_{std::numeric_limits<double>::epsilon()};
+  //! Return mapping controls
+  //! Tolerance for yield function
+  double ftolerance_{1.E-5};
+  //! Tolerance for preconsolidation function
+  double gtolerance_{1.E-5};
+  //! Maximum iteration step number
+  unsigned max_iterations_{100};
+  //! Maximum subiteration step number
+  unsigned max_subiterations_{100};
+  //! Maximum number of substeps of a strain increment
+  unsigned max_substeps_{1};
 };  // ModifiedCamClay class
 }  // namespace mpm
 
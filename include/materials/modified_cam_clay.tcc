@@ -62,6 +62,24 @@ mpm::ModifiedCamClay<Tdim>::ModifiedCamClay(unsigned id,
       // Increment in shear modulus
       m_shear_ = material_properties.at("m_shear").template get<double>();
     }
+    // Return mapping controls
+    if (material_properties.find("ftolerance") != material_properties.end())
+      ftolerance_ =
+          material_properties.at("ftolerance").template get<double>();
+    if (material_properties.find("gtolerance") != material_properties.end())
+      gtolerance_ =
+          material_properties.at("gtolerance").template get<double>();
+    if (material_properties.find("max_iterations") !=
+        material_properties.end())
+      max_iterations_ =
+          material_properties.at("max_iterations").template get<unsigned>();
+    if (material_properties.find("max_subiterations") !=
+        material_properties.end())
+      max_subiterations_ =
+          material_properties.at("max_subiterations").template get<unsigned>();
+    if (material_properties.find("max_substeps") != material_properties.end())
+      max_substeps_ =
+          material_properties.at("max_substeps").template get<unsigned>();
 
     // Properties
     properties_ = material_properties;
@@ -518,14 +536,75 @@ template <unsigned Tdim>
 Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
     const Vector6d& stress, const Vector6d& dstrain,
     const ParticleBase<Tdim>* ptr, mpm::dense_map* state_vars) {
-  // Tolerance for yield function
-  const double Ftolerance = 1.E-5;
-  // Tolerance for preconsolidation function
-  const double Gtolerance = 1.E-5;
-  // Maximum iteration step number
-  const int itrstep = 100;
-  // Maximum subiteration step number
-  const int substep = 100;
+  UpdateStatistics statistics;
+  const Vector6d updated_stress =
+      this->update_stress(stress, dstrain, state_vars, &statistics);
+  this->add_statistics(statistics);
+  return updated_stress;
+}
+
+//! Compute trial stress of an implicit iteration
+template <unsigned Tdim>
+Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_trial_stress(
+    const Vector6d& stress, const Vector6d& dstrain,
+    const ParticleBase<Tdim>* ptr, mpm::dense_map* state_vars) {
+  UpdateStatistics statistics;
+  return this->update_stress(stress, dstrain, state_vars, &statistics);
+}
+
+//! Compute stresses of a batch of particles
+template <unsigned Tdim>
+void mpm::ModifiedCamClay<Tdim>::compute_stresses(
+    Matrix6X* stresses, const Matrix6X& dstrains,
+    const std::vector<const ParticleBase<Tdim>*>& particles,
+    const std::vector<mpm::dense_map*>& state_vars) {
+  UpdateStatistics statistics;
+  for (unsigned i = 0; i < particles.size(); ++i)
+    stresses->col(i) = this->update_stress(stresses->col(i), dstrains.col(i),
+                                           state_vars[i], &statistics);
+  this->add_statistics(statistics);
+}
+
+//! Update stress and accumulate the statistics of the update
+template <unsigned Tdim>
+Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::update_stress(
+    const Vector6d& stress, const Vector6d& dstrain,
+    mpm::dense_map* state_vars, UpdateStatistics* statistics) {
+  ++statistics->nupdates;
+  // State variables at the beginning of the increment
+  const mpm::dense_map state_vars_n =
+      (max_substeps_ > 1) ? (*state_vars) : mpm::dense_map();
+  // Return mapping of the whole strain increment
+  bool converged = true;
+  Vector6d updated_stress =
+      this->return_mapping(stress, dstrain, state_vars, &converged, statistics);
+  // Sub-stepping: halve the substeps until each substep converges
+  for (unsigned nsubsteps = 2; !converged && nsubsteps <= max_substeps_;
+       nsubsteps *= 2) {
+    const bool last = (nsubsteps * 2 > max_substeps_);
+    const Vector6d dstrain_substep = dstrain / nsubsteps;
+    *state_vars = state_vars_n;
+    updated_stress = stress;
+    converged = true;
+    for (unsigned i = 0; i < nsubsteps && (converged || last); ++i) {
+      bool substep_converged = true;
+      updated_stress =
+          this->return_mapping(updated_stress, dstrain_substep, state_vars,
+                               &substep_converged, statistics);
+      converged = converged && substep_converged;
+      ++statistics->nsubsteps;
+    }
+  }
+  if (!converged) ++statistics->nnonconverged;
+  return updated_stress;
+}
+
+//! Closest point return mapping of a strain increment
+template <unsigned Tdim>
+Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::return_mapping(
+    const Vector6d& stress, const Vector6d& dstrain,
+    mpm::dense_map* state_vars, bool* converged,
+    UpdateStatistics* statistics) {
   // Compute current mean pressure
   (*state_vars).at("p") = -(stress(0) + stress(1) + stress(2)) / 3.;
   // Set elastic tensor
@@ -560,8 +639,8 @@ Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
   //-------------------------------------------------------------------------
   // Plastic step
   // Counters for interations
-  int counter_f = 0;
-  int counter_g = 0;
+  unsigned counter_f = 0;
+  unsigned counter_g = 0;
   // Initialise consistency parameter
   (*state_vars).at("delta_phi") = 0.;
   // Volumetric trial stress
@@ -577,8 +656,8 @@ Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
   // Initialise updated stress
   Vector6d updated_stress = trial_stress;
   // Iteration for consistency parameter
-  while (std::fabs((*state_vars).at("f_function")) > Ftolerance &&
-         counter_f < itrstep) {
+  while (std::fabs((*state_vars).at("f_function")) > ftolerance_ &&
+         counter_f < max_iterations_) {
     // Get back the m_theta of trial_stress
     (*state_vars).at("m_theta") = m_theta_trial;
     // Compute dF / dmul
@@ -591,7 +670,8 @@ Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
     // Compute G and dG / dpc
     this->compute_dg_dpc(state_vars, pc_n, p_trial, &g_function, &dg_dpc);
     // Subiteraction for preconsolidation pressure
-    while (std::fabs(g_function) > Gtolerance && counter_g < substep) {
+    while (std::fabs(g_function) > gtolerance_ &&
+           counter_g < max_subiterations_) {
       // Update preconsolidation pressure
       (*state_vars).at("pc") -= g_function / dg_dpc;
       // Update G and dG / dpc
@@ -647,6 +727,9 @@ Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
     // Counter iteration step
     ++counter_f;
   }
+  // Iteration statistics
+  statistics->niterations += counter_f;
+  *converged = (std::fabs((*state_vars).at("f_function")) <= ftolerance_);
   // Update plastic strain
   (*state_vars).at("pvstrain") += (*state_vars).at("dpvstrain");
   (*state_vars).at("pdstrain") += (*state_vars).at("dpdstrain");
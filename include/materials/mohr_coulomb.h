@@ -27,6 +27,8 @@ class MohrCoulomb : public Material<Tdim> {
   using Vector6d = Eigen::Matrix<double, 6, 1>;
   //! Define a Matrix of 6 x 6
   using Matrix6x6 = Eigen::Matrix<double, 6, 6>;
+  //! Define a Matrix of 6 x n
+  using Matrix6X = Eigen::Matrix<double, 6, Eigen::Dynamic>;
 
   //! Constructor with id and material properties
   //! \param[in] material_properties Material properties
@@ -58,6 +60,16 @@ class MohrCoulomb : public Material<Tdim> {
                           const ParticleBase<Tdim>* ptr,
                           mpm::dense_map* state_vars) override;
 
+  //! Compute stresses of a batch of particles sharing the material
+  //! \param[in,out] stresses Stresses of particles, one column per particle
+  //! \param[in] dstrains Strain increments, one column per particle
+  //! \param[in] particles Constant pointers to particles
+  //! \param[in] state_vars History-dependent state variables of particles
+  void compute_stresses(
+      Matrix6X* stresses, const Matrix6X& dstrains,
+      const std::vector<const ParticleBase<Tdim>*>& particles,
+      const std::vector<mpm::dense_map*>& state_vars) override;
+
   //! Compute stress invariants (j2, j3, rho, theta, and epsilon)
   //! \param[in] stress Stress
   //! \param[in] state_vars History-dependent state variables
@@ -97,6 +109,20 @@ class MohrCoulomb : public Material<Tdim> {
   //! Compute elastic tensor
   bool compute_elastic_tensor();
 
+  //! Update friction, dilation and cohesion with the softening rule
+  //! \param[in] state_vars History-dependent state variables
+  void update_softening(mpm::dense_map* state_vars) const;
+
+  //! Correct the trial stress back to the yield surface
+  //! \param[in] stress Stress
+  //! \param[in] dstrain Strain
+  //! \param[in] trial_stress Elastic trial stress
+  //! \param[in] state_vars History-dependent state variables
+  //! \retval updated_stress Updated value of stress
+  Vector6d return_mapping(const Vector6d& stress, const Vector6d& dstrain,
+                          const Vector6d& trial_stress,
+                          mpm::dense_map* state_vars);
+
   //! Elastic stiffness matrix
   Matrix6x6 de_;
   //! Density
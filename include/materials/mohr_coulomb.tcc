@@ -324,11 +324,10 @@ void mpm::MohrCoulomb<Tdim>::compute_df_dp(
   }
 }
 
-//! Compute stress
+//! Update MC parameters with the softening rule
 template <unsigned Tdim>
-Eigen::Matrix<double, 6, 1> mpm::MohrCoulomb<Tdim>::compute_stress(
-    const Vector6d& stress, const Vector6d& dstrain,
-    const ParticleBase<Tdim>* ptr, mpm::dense_map* state_vars) {
+void mpm::MohrCoulomb<Tdim>::update_softening(
+    mpm::dense_map* state_vars) const {
   // Get equivalent plastic deviatoric strain
   const double pdstrain = (*state_vars).at("pdstrain");
   // Update MC parameters using a linear softening rule
@@ -352,9 +351,44 @@ Eigen::Matrix<double, 6, 1> mpm::MohrCoulomb<Tdim>::compute_stress(
       (*state_vars).at("cohesion") = cohesion_residual_;
     }
   }
+}
+
+//! Compute stress
+template <unsigned Tdim>
+Eigen::Matrix<double, 6, 1> mpm::MohrCoulomb<Tdim>::compute_stress(
+    const Vector6d& stress, const Vector6d& dstrain,
+    const ParticleBase<Tdim>* ptr, mpm::dense_map* state_vars) {
+  // Update MC parameters using a linear softening rule
+  this->update_softening(state_vars);
   //-------------------------------------------------------------------------
   // Elastic-predictor stage: compute the trial stress
-  Vector6d trial_stress = stress + (this->de_ * dstrain);
+  const Vector6d trial_stress = stress + (this->de_ * dstrain);
+  return this->return_mapping(stress, dstrain, trial_stress, state_vars);
+}
+
+//! Compute stresses of a batch of particles
+template <unsigned Tdim>
+void mpm::MohrCoulomb<Tdim>::compute_stresses(
+    Matrix6X* stresses, const Matrix6X& dstrains,
+    const std::vector<const ParticleBase<Tdim>*>& particles,
+    const std::vector<mpm::dense_map*>& state_vars) {
+  // Update MC parameters using a linear softening rule
+  for (unsigned i = 0; i < particles.size(); ++i)
+    this->update_softening(state_vars[i]);
+  // Elastic-predictor stage: trial stresses of all particles
+  const Matrix6X trial_stresses = (*stresses) + this->de_ * dstrains;
+  // Plastic-corrector stage for each particle
+  for (unsigned i = 0; i < particles.size(); ++i)
+    stresses->col(i) =
+        this->return_mapping(stresses->col(i), dstrains.col(i),
+                             trial_stresses.col(i), state_vars[i]);
+}
+
+//! Correct the trial stress back to the yield surface
+template <unsigned Tdim>
+Eigen::Matrix<double, 6, 1> mpm::MohrCoulomb<Tdim>::return_mapping(
+    const Vector6d& stress, const Vector6d& dstrain,
+    const Vector6d& trial_stress, mpm::dense_map* state_vars) {
   // Compute stress invariants based on trial stress
   this->compute_stress_invariants(trial_stress, state_vars);
   // Compute yield function based on the trial stress
@@ -111,3 +111,42 @@ Eigen::Matrix<double, 6, 1> mpm::Newtonian<3>::compute_stress(
 
   return pstress;
 }
+
+//! Compute stresses of a batch of particles
+template <unsigned Tdim>
+void mpm::Newtonian<Tdim>::compute_stresses(
+    Matrix6X* stresses, const Matrix6X& dstrains,
+    const std::vector<const ParticleBase<Tdim>*>& particles,
+    const std::vector<mpm::dense_map*>& state_vars) {
+  const unsigned nparticles = particles.size();
+
+  // Gather strain rates and update pressures
+  Matrix6X strain_rates(6, nparticles);
+  Eigen::RowVectorXd pressures(nparticles);
+  for (unsigned i = 0; i < nparticles; ++i) {
+    strain_rates.col(i) = particles[i]->strain_rate();
+    double& pressure = (*state_vars[i]).at("pressure");
+    pressure += (compressibility_multiplier_ *
+                 this->thermodynamic_pressure(
+                     particles[i]->dvolumetric_strain()));
+    pressures(i) = pressure;
+  }
+
+  // Volumetric stress component
+  const Eigen::RowVectorXd volumetric_component =
+      compressibility_multiplier_ *
+      (-pressures -
+       (2. * dynamic_viscosity_ / 3.) *
+           strain_rates.topRows(Tdim).colwise().sum());
+
+  // Update stress components
+  stresses->setZero();
+  stresses->topRows(Tdim) =
+      (2. * dynamic_viscosity_) * strain_rates.topRows(Tdim) +
+      volumetric_component.replicate(Tdim, 1);
+  for (unsigned i = Tdim; i < 3; ++i) stresses->row(i) = volumetric_component;
+  // Shear components
+  const unsigned nshear = (Tdim == 3) ? 3 : 1;
+  stresses->middleRows(3, nshear) =
+      dynamic_viscosity_ * strain_rates.middleRows(3, nshear);
+}
@@ -1,6 +1,7 @@
 #ifndef MPM_MATERIAL_NORSAND_H_
 #define MPM_MATERIAL_NORSAND_H_
 
+#include <algorithm>
 #include <cmath>
 
 #include "Eigen/Dense"
@@ -25,6 +26,10 @@ class NorSand : public Material<Tdim> {
   using Vector6d = Eigen::Matrix<double, 6, 1>;
   //! Define a Matrix of 6 x 6
   using Matrix6x6 = Eigen::Matrix<double, 6, 6>;
+  //! Define a Matrix of 6 x n
+  using Matrix6X = Eigen::Matrix<double, 6, Eigen::Dynamic>;
+  //! Statistics of stress updates
+  using UpdateStatistics = typename Material<Tdim>::UpdateStatistics;
 
   //! Constructor with id and material properties
   //! \param[in] material_properties Material properties
@@ -56,6 +61,29 @@ class NorSand : public Material<Tdim> {
                           const ParticleBase<Tdim>* ptr,
                           mpm::dense_map* state_vars) override;
 
+  //! Compute trial stress of an implicit iteration, which is not counted in
+  //! the statistics of stress updates
+  //! \param[in] stress Stress
+  //! \param[in] dstrain Strain
+  //! \param[in] particle Constant point to particle base
+  //! \param[in] state_vars History-dependent state variables
+  //! \retval updated_stress Trial value of stress
+  Vector6d compute_trial_stress(const Vector6d& stress,
+                                const Vector6d& dstrain,
+                                const ParticleBase<Tdim>* ptr,
+                                mpm::dense_map* state_vars) override;
+
+  //! Compute stresses of a batch of particles sharing the material, with
+  //! the statistics of the batch added once
+  //! \param[in,out] stresses Stresses of particles, one column per particle
+  //! \param[in] dstrains Strain increments, one column per particle
+  //! \param[in] particles Constant pointers to particles
+  //! \param[in] state_vars History-dependent state variables of particles
+  void compute_stresses(
+      Matrix6X* stresses, const Matrix6X& dstrains,
+      const std::vector<const ParticleBase<Tdim>*>& particles,
+      const std::vector<mpm::dense_map*>& state_vars) override;
+
  protected:
   //! material id
   using Material<Tdim>::id_;
@@ -65,9 +93,27 @@ class NorSand : public Material<Tdim> {
   using Material<Tdim>::console_;
 
  private:
+  //! Update stress and accumulate the statistics of the update
+  //! \param[in] stress Stress
+  //! \param[in] dstrain Strain
+  //! \param[in] state_vars History-dependent state variables
+  //! \param[in,out] statistics Statistics of stress updates
+  //! \retval updated_stress Updated value of stress
+  Vector6d update_stress(const Vector6d& stress, const Vector6d& dstrain,
+                         mpm::dense_map* state_vars,
+                         UpdateStatistics* statistics);
+
   //! Compute elastic tensor
   bool compute_elastic_tensor();
 
+  //! Integrate stress over a strain increment in a single step
+  //! \param[in] stress Stress
+  //! \param[in] dstrain Strain
+  //! \param[in] state_vars History-dependent state variables
+  //! \retval updated_stress Updated value of stress
+  Vector6d integrate_stress(const Vector6d& stress, const Vector6d& dstrain,
+                            mpm::dense_map* state_vars);
+
   //! Compute plastic tensor
   void compute_plastic_tensor(const Vector6d& stress,
                               mpm::dense_map* state_vars);
@@ -169,6 +215,10 @@ class NorSand : public Material<Tdim> {
   double m_modulus_{0.};
   //! Default tolerance
   double tolerance_{std::numeric_limits<double>::epsilon()};
+  //! Maximum number of substeps of a strain increment
+  unsigned max_substeps_{1};
+  //! Relative error tolerance of a substep
+  double substep_tolerance_{1.E-4};
 
 };  // NorSand class
 }  // namespace mpm
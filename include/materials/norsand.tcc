@@ -58,6 +58,15 @@ mpm::NorSand<Tdim>::NorSand(unsigned id, const Json& material_properties)
     if (material_properties.find("tolerance") != material_properties.end())
       tolerance_ = material_properties.at("tolerance").template get<double>();
 
+    // Sub-stepping controls
+    if (material_properties.find("max_substeps") != material_properties.end())
+      max_substeps_ =
+          material_properties.at("max_substeps").template get<unsigned>();
+    if (material_properties.find("substep_tolerance") !=
+        material_properties.end())
+      substep_tolerance_ =
+          material_properties.at("substep_tolerance").template get<double>();
+
     const double sin_friction_cs = sin(friction_cs_);
     Mtc_ = (6 * sin_friction_cs) / (3 - sin_friction_cs);
     Mte_ = (6 * sin_friction_cs) / (3 + sin_friction_cs);
@@ -407,6 +416,92 @@ template <unsigned Tdim>
 Eigen::Matrix<double, 6, 1> mpm::NorSand<Tdim>::compute_stress(
     const Vector6d& stress, const Vector6d& dstrain,
     const ParticleBase<Tdim>* ptr, mpm::dense_map* state_vars) {
+  UpdateStatistics statistics;
+  const Vector6d updated_stress =
+      this->update_stress(stress, dstrain, state_vars, &statistics);
+  this->add_statistics(statistics);
+  return updated_stress;
+}
+
+//! Compute trial stress of an implicit iteration
+template <unsigned Tdim>
+Eigen::Matrix<double, 6, 1> mpm::NorSand<Tdim>::compute_trial_stress(
+    const Vector6d& stress, const Vector6d& dstrain,
+    const ParticleBase<Tdim>* ptr, mpm::dense_map* state_vars) {
+  UpdateStatistics statistics;
+  return this->update_stress(stress, dstrain, state_vars, &statistics);
+}
+
+//! Compute stresses of a batch of particles
+template <unsigned Tdim>
+void mpm::NorSand<Tdim>::compute_stresses(
+    Matrix6X* stresses, const Matrix6X& dstrains,
+    const std::vector<const ParticleBase<Tdim>*>& particles,
+    const std::vector<mpm::dense_map*>& state_vars) {
+  UpdateStatistics statistics;
+  for (unsigned i = 0; i < particles.size(); ++i)
+    stresses->col(i) = this->update_stress(stresses->col(i), dstrains.col(i),
+                                           state_vars[i], &statistics);
+  this->add_statistics(statistics);
+}
+
+//! Update stress and accumulate the statistics of the update
+template <unsigned Tdim>
+Eigen::Matrix<double, 6, 1> mpm::NorSand<Tdim>::update_stress(
+    const Vector6d& stress, const Vector6d& dstrain,
+    mpm::dense_map* state_vars, UpdateStatistics* statistics) {
+  ++statistics->nupdates;
+  // Single step integration
+  if (max_substeps_ <= 1)
+    return this->integrate_stress(stress, dstrain, state_vars);
+
+  // Error-controlled explicit sub-stepping: a substep is compared against two
+  // half substeps, and accepted when their relative difference is within the
+  // tolerance or the substep reaches its minimum size
+  const double dtime_min = 1. / max_substeps_;
+  Vector6d updated_stress = stress;
+  double time = 0.;
+  double dtime = 1.;
+  bool converged = true;
+  while (time < 1. - std::numeric_limits<double>::epsilon()) {
+    dtime = std::min(dtime, 1. - time);
+    const Vector6d dstrain_substep = dtime * dstrain;
+    // One full substep
+    mpm::dense_map state_vars_full = *state_vars;
+    const Vector6d stress_full = this->integrate_stress(
+        updated_stress, dstrain_substep, &state_vars_full);
+    // Two half substeps
+    mpm::dense_map state_vars_half = *state_vars;
+    Vector6d stress_half = this->integrate_stress(
+        updated_stress, 0.5 * dstrain_substep, &state_vars_half);
+    stress_half = this->integrate_stress(stress_half, 0.5 * dstrain_substep,
+                                         &state_vars_half);
+    ++statistics->niterations;
+
+    // Relative error of the substep
+    const double error =
+        (stress_half - stress_full).norm() /
+        std::max(stress_half.norm(), std::numeric_limits<double>::epsilon());
+
+    if (error <= substep_tolerance_ || dtime <= dtime_min) {
+      if (error > substep_tolerance_) converged = false;
+      updated_stress = stress_half;
+      *state_vars = state_vars_half;
+      time += dtime;
+      ++statistics->nsubsteps;
+      dtime *= 2.;
+    } else
+      dtime = std::max(0.5 * dtime, dtime_min);
+  }
+  if (!converged) ++statistics->nnonconverged;
+  return updated_stress;
+}
+
+//! Integrate stress over a strain increment in a single step
+template <unsigned Tdim>
+Eigen::Matrix<double, 6, 1> mpm::NorSand<Tdim>::integrate_stress(
+    const Vector6d& stress, const Vector6d& dstrain,
+    mpm::dense_map* state_vars) {
 
   // Note: compression positive in all derivations
   Vector6d stress_neg = -1 * stress;
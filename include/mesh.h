@@ -5,7 +5,11 @@
 #include <array>
 #include <limits>
 #include <memory>
+#include <map>
 #include <numeric>
+#include <set>
+#include <sstream>
+#include <string>
 #include <vector>
 
 // Eigen
@@ -25,6 +29,7 @@
 using Json = nlohmann::json;
 
 #include "cell.h"
+#include "cell_list.h"
 #include "factory.h"
 #include "friction_constraint.h"
 #include "function_base.h"
@@ -37,8 +42,12 @@ using Json = nlohmann::json;
 #include "material.h"
 #include "nodal_properties.h"
 #include "node.h"
+#include "parallel_for.h"
 #include "particle.h"
 #include "particle_base.h"
+#include "pool.h"
+#include "profiler.h"
+#include "shapefn_cache.h"
 #include "traction.h"
 #include "vector.h"
 #include "velocity_constraint.h"
@@ -75,6 +84,18 @@ class Mesh {
   //! Return if a mesh is isoparametric
   bool is_isoparametric() const { return isoparametric_; }
 
+  //! Place nodes and particles for NUMA-aware loops
+  //! \details Nodes and particles are then created in parallel with the
+  //! static partition of loops over them, and particles of each thread are
+  //! placed in a memory pool of the thread. Loops over all nodes, particles
+  //! and shape functions use the same static schedule, other loops keep the
+  //! runtime schedule
+  //! \param[in] status NUMA-aware placement
+  void numa_aware(bool status);
+
+  //! Return if nodes and particles are placed for NUMA-aware loops
+  bool numa_aware() const { return numa_aware_; }
+
   //! Create nodes from coordinates
   //! \param[in] gnid Global node id
   //! \param[in] node_type Node type
@@ -116,7 +137,7 @@ class Mesh {
 
   //! Return a vector of nodes
   //! \param[in] set_id Set of id of nodes (-1 for all nodes)
-  Vector<NodeBase<Tdim>> nodes(unsigned set_id) const {
+  const Vector<NodeBase<Tdim>>& nodes(int set_id) const {
     return (set_id == -1) ? this->nodes_ : node_sets_.at(set_id);
   }
 
@@ -133,6 +154,26 @@ class Mesh {
   template <typename Toper>
   void iterate_over_active_nodes(Toper oper);
 
+  //! Update the per-step plan if the mesh topology has changed
+  //! \details Caches the particles of each particle set and traction and the
+  //! nodes to reset every step, the plan is invalidated when nodes, cells,
+  //! particles, particle sets, tractions or concentrated forces change. The
+  //! plan is rebuilt as a whole, in O(nparticles + nnodes) serial work, so a
+  //! step that adds or removes particles, e.g., by migration or injection,
+  //! pays for one rebuild in the next step
+  void update_step_plan();
+
+  //! Initialise nodes used in the previous step and activate nodes of cells
+  //! with particles, all nodes are initialised after a topology change
+  //! \details Nodes are activated by cells in parallel and the active nodes
+  //! are gathered by chunks of nodes in parallel
+  void initialise_step_nodes();
+
+  //! Apply concentrated forces on nodes with concentrated forces
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] current_time Current time
+  void apply_nodal_concentrated_forces(unsigned phase, double current_time);
+
 #ifdef USE_MPI
   //! All reduce over nodal property
   //! \tparam Ttype Type of property to accumulate
@@ -217,6 +258,11 @@ class Mesh {
   //! \param[in] pids Vector of particle ids
   void remove_particles(const std::vector<mpm::Index>& pids);
 
+  //! Remove the particles of a particle set present on this rank
+  //! \param[in] set_id Particle set id
+  //! \retval status Particle set is found
+  bool remove_particle_set(unsigned set_id);
+
   //! Remove all particles in a cell in nonlocal rank
   void remove_all_nonrank_particles();
 
@@ -249,11 +295,49 @@ class Mesh {
   void iterate_over_particles(Toper oper);
 
   //! Iterate over particle set
+  //! \details The callable receives a particle shared_ptr, as for all
+  //! particles, and the particles of the set are cached in the step plan
   //! \tparam Toper Callable object typically a baseclass functor
   //! \param[in] set_id particle set id
   template <typename Toper>
   void iterate_over_particle_set(int set_id, Toper oper);
 
+  //! Compute strains of particles
+  //! \details The volumetric strain rate at the centroid of each cell with
+  //! particles is computed once and shared by the particles of the cell
+  //! \param[in] dt Time step
+  void compute_particle_strains(double dt);
+
+  //! Compute shape functions of particles in the shape function cache
+  void compute_shapefn();
+
+  //! Compute the critical time step of particles, which is the minimum of
+  //! cell mean length / (wave speed + particle speed)
+  //! \param[in] wave_speeds Elastic wave speeds of materials by material id
+  //! \param[in] phase Index corresponding to the phase
+  //! \retval dt Critical time step, max double without moving particles
+  double critical_time_step(const std::map<unsigned, double>& wave_speeds,
+                            unsigned phase = mpm::ParticlePhase::Solid) const;
+
+  //! Compute the kinetic energy of particles
+  //! \retval energy Kinetic energy of particles of this rank
+  double kinetic_energy() const;
+
+  //! Compute the squared norms of the unbalanced and external nodal forces
+  //! \details Unbalanced forces exclude directions with velocity constraints,
+  //! and nodes shared by MPI ranks are weighted by the number of ranks, so
+  //! the sums over ranks count a node once
+  //! \param[in] phase Index corresponding to the phase
+  //! \retval norms Squared norms of the unbalanced and external forces
+  std::pair<double, double> unbalanced_force_norms(
+      unsigned phase = mpm::ParticlePhase::Solid) const;
+
+  //! Compute stresses of particles in batches sharing a material
+  //! \details Groups of particles by material are kept with the step plan and
+  //! are only rebuilt when particles or their materials change
+  //! \param[in] phase Index corresponding to the phase
+  void compute_particle_stresses(unsigned phase = mpm::ParticlePhase::Solid);
+
   //! Return coordinates of particles
   std::vector<Eigen::Matrix<double, 3, 1>> particle_coordinates();
 
@@ -302,6 +386,8 @@ class Mesh {
       double traction);
 
   //! Apply traction to particles
+  //! \details The step plan is updated first if needed, a caller running this
+  //! in a task alongside others updates the plan before the tasks start
   //! \param[in] current_time Current time
   void apply_traction_on_particles(double current_time);
 
@@ -313,6 +399,10 @@ class Mesh {
   //! Apply particles velocity constraints
   void apply_particle_velocity_constraints();
 
+  //! Clear nodal velocity and friction constraints, nodal rotation matrices
+  //! and particle velocity constraints
+  void clear_boundary_conditions();
+
   //! Assign nodal concentrated force
   //! \param[in] nodal_forces Force at dir on nodes
   bool assign_nodal_concentrated_forces(
@@ -328,6 +418,9 @@ class Mesh {
       const std::shared_ptr<FunctionBase>& mfunction, int set_id, unsigned dir,
       double force);
 
+  //! Clear particle tractions and nodal concentrated forces
+  void clear_loads();
+
   //! Assign particles stresses
   //! \param[in] particle_stresses Initial stresses of particle
   bool assign_particles_stresses(
@@ -367,13 +460,24 @@ class Mesh {
   }
 
   //! Find particle neighbours
-  //! \param[in] cell of interest
+  //! \details Builds the cell list and assigns it to each particle, which
+  //! reads the ids of the particles in its cell and the neighbour cells as
+  //! ranges of the cell list
   void find_particle_neighbours();
 
   //! Find particle neighbours
+  //! \details Uses the cell list of the last build
   //! \param[in] cell of interest
   void find_particle_neighbours(const std::shared_ptr<mpm::Cell<Tdim>>& cell);
 
+  //! Build the cell list of particles in local cells and their neighbours
+  //! \details Particle ids of neighbour cells on other MPI ranks are
+  //! exchanged in one message per neighbour rank
+  void build_cell_list();
+
+  //! Return the cell list of particles
+  const mpm::CellList& cell_list() const { return *cell_list_; }
+
   //! Add a neighbour mesh, using the local id for the new mesh and a mesh
   //! pointer
   //! \param[in] local_id local id of the mesh
@@ -391,15 +495,51 @@ class Mesh {
   //! Write HDF5 particles
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] filename Name of HDF5 file to write particles data
+  //! \param[in] single_precision Write real fields as float
   //! \retval status Status of writing HDF5 output
-  bool write_particles_hdf5(unsigned phase, const std::string& filename);
+  bool write_particles_hdf5(unsigned phase, const std::string& filename,
+                            bool single_precision = false);
+
+  //! Write the partition and the particles of cells to HDF5
+  //! \details Stores the rank of each cell and the ids of the particles in
+  //! each cell of this rank, which restore a checkpoint
+  //! \param[in] filename Name of an existing HDF5 file
+  //! \retval status Status of writing the cells
+  bool write_particles_cells_hdf5(const std::string& filename) const;
 
   //! Read HDF5 particles
+  //! \details Reads compact versioned tables and tables with all fields
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] filename Name of HDF5 file to write particles data
   //! \retval status Status of reading HDF5 output
   bool read_particles_hdf5(unsigned phase, const std::string& filename);
 
+  //! Initialise particles from HDF5 particles
+  //! \details Existing particles are reinitialised in the order of the
+  //! records and particles beyond the number of records are removed
+  //! \param[in] hdf5_particles HDF5 particles
+  //! \param[in] restore_state_vars State variables of a record are restored,
+  //! otherwise the initial state variables of the material are assigned. All
+  //! state variables are restored if it is empty.
+  //! \retval status Status of initialising particles
+  bool initialise_particles_hdf5(
+      const std::vector<mpm::HDF5Particle>& hdf5_particles,
+      const std::vector<bool>& restore_state_vars = std::vector<bool>());
+
+  //! Restore the partition and the particles of cells from HDF5
+  //! \details Assigns the stored rank to each cell and the particles to their
+  //! stored cells in the stored order. Only the local coordinates of the
+  //! particles are computed, which validates that a particle is in its cell.
+  //! Particles outside their stored cell are located by a search.
+  //! \param[in] filename Name of HDF5 file with particles data
+  //! \param[out] unlocatable_particles Particles outside the mesh
+  //! \retval status File has the partition and the particles of cells of
+  //! this mesh and number of ranks
+  bool read_particles_cells_hdf5(
+      const std::string& filename,
+      std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>>*
+          unlocatable_particles);
+
   //! Return HDF5 particles
   //! \retval particles_hdf5 Vector of HDF5 particles
   std::vector<mpm::HDF5Particle> particles_hdf5() const;
@@ -452,15 +592,46 @@ class Mesh {
   bool generate_particles(const std::shared_ptr<mpm::IO>& io,
                           const Json& generator);
 
-  //! Inject particles
+  //! Check if any particle injection is active at the current time
+  //! \param[in] current_time Current time
+  bool injection_active(double current_time) const;
+
+  //! Inject particles in empty cells of active injections
+  //! \details Particles are created in parallel at cached local points of
+  //! the element, with ids allocated from a rank-partitioned counter above
+  //! the largest particle id. Injections with a flow rate fill cells until
+  //! the volume of the particles injected over all ranks reaches flow rate x
+  //! elapsed time.
+  //! \param[in] current_time Current time
   void inject_particles(double current_time);
 
+  //! Return the id of an injected particle, partitioned by rank so that ids
+  //! are unique across ranks and injections
+  //! \param[in] offset First id of injected particles
+  //! \param[in] counter Number of ids allocated for injection on the rank
+  //! \param[in] index Index of the particle in the injection on the rank
+  //! \param[in] mpi_rank MPI rank
+  //! \param[in] mpi_size Number of MPI ranks
+  static mpm::Index injected_particle_id(mpm::Index offset, mpm::Index counter,
+                                         mpm::Index index, int mpi_rank,
+                                         int mpi_size) {
+    return offset + mpi_rank + mpi_size * (counter + index);
+  }
+
   // Create the nodal properties' map
   void create_nodal_properties();
 
   // Initialise the nodal properties' map
   void initialise_nodal_properties();
 
+  //! Return the memory pool of particles
+  std::shared_ptr<mpm::Pool> particle_pool() const { return particle_pool_; }
+
+  //! Return the shape function cache of particles
+  std::shared_ptr<mpm::ShapefnCache> shapefn_cache() const {
+    return shapefn_cache_;
+  }
+
  private:
   // Read particles from file
   //! \param[in] pset_id Set ID of the particles
@@ -471,6 +642,17 @@ class Mesh {
   bool locate_particle_cells(
       const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle);
 
+  //! Create particles in the memory pools of threads
+  //! \details In NUMA-aware mode the particles are created in parallel with
+  //! the static partition of particle loops
+  //! \param[in] particle_type Particle type
+  //! \param[in] first_id Id of the first particle
+  //! \param[in] coordinates Coordinates of particles
+  //! \retval particles Particles with consecutive ids
+  std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>> construct_particles(
+      const std::string& particle_type, mpm::Index first_id,
+      const std::vector<VectorDim>& coordinates);
+
  private:
   //! mesh id
   unsigned id_{std::numeric_limits<unsigned>::max()};
@@ -521,6 +703,47 @@ class Mesh {
       particle_velocity_constraints_;
   //! Vector of generators for particle injections
   std::vector<mpm::Injection> particle_injections_;
+  //! Step plan is valid for the current topology
+  bool step_plan_valid_{false};
+  //! Particles of each particle set
+  tsl::robin_map<unsigned,
+                 std::vector<std::shared_ptr<ParticleBase<Tdim>>>>
+      particle_set_particles_;
+  //! Particles of each particle traction
+  std::vector<std::vector<ParticleBase<Tdim>*>> traction_particles_;
+  //! Particles with tractions
+  std::vector<ParticleBase<Tdim>*> traction_force_particles_;
+  //! Particles of each material in the stress update of each phase
+  std::map<unsigned, std::vector<std::vector<ParticleBase<Tdim>*>>>
+      material_particles_;
+  //! Nodes with concentrated forces
+  Vector<NodeBase<Tdim>> concentrated_force_nodes_;
+  //! Nodes used in the previous step
+  std::vector<NodeBase<Tdim>*> step_nodes_;
+  //! Cells of each particle injection on this rank
+  std::vector<std::vector<std::shared_ptr<Cell<Tdim>>>> injection_cells_;
+  //! Shape functions at local points of injected particles by element and
+  //! number of particles per direction
+  std::map<std::pair<const Element<Tdim>*, unsigned>, Eigen::MatrixXd>
+      injection_shapefns_;
+  //! Ids of injected particles are initialised
+  bool injection_ids_initialised_{false};
+  //! First id of injected particles
+  mpm::Index injection_id_offset_{0};
+  //! Number of particle ids allocated for injection on this rank
+  mpm::Index injection_counter_{0};
+  //! Memory pool of particles
+  std::shared_ptr<mpm::Pool> particle_pool_{nullptr};
+  //! NUMA-aware placement of nodes and particles
+  bool numa_aware_{false};
+  //! Memory pools of particles of each thread in NUMA-aware mode
+  std::vector<std::shared_ptr<mpm::Pool>> particle_pools_;
+  //! Particles of local cells and their neighbour cells
+  std::shared_ptr<mpm::CellList> cell_list_{nullptr};
+  //! Shape functions and gradients of particles
+  std::shared_ptr<mpm::ShapefnCache> shapefn_cache_{nullptr};
+  //! Largest number of shape functions of a cell
+  unsigned max_nfunctions_{0};
   //! Nodal property pool
   std::shared_ptr<mpm::NodalProperties> nodal_properties_{nullptr};
   //! Logger
@@ -8,9 +8,32 @@ mpm::Mesh<Tdim>::Mesh(unsigned id, bool isoparametric)
   std::string logger = "mesh::" + std::to_string(id);
   console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
 
+  // Particles are placed in slabs of a pool with stable addresses
+  particle_pool_ = std::make_shared<mpm::Pool>();
+  // Shape functions of particles are stored with a fixed stride
+  shapefn_cache_ = std::make_shared<mpm::ShapefnCache>();
+  // Particles of local cells and their neighbour cells
+  cell_list_ = std::make_shared<mpm::CellList>();
+
   particles_.clear();
 }
 
+//! Place nodes and particles for NUMA-aware loops
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::numa_aware(bool status) {
+  numa_aware_ = status;
+  particle_pools_.clear();
+  if (numa_aware_) {
+    // Memory pool of particles of each thread
+    int nthreads = 1;
+#ifdef _OPENMP
+    nthreads = omp_get_max_threads();
+#endif
+    for (int thread = 0; thread < nthreads; ++thread)
+      particle_pools_.emplace_back(std::make_shared<mpm::Pool>());
+  }
+}
+
 //! Create nodes from coordinates
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::create_nodes(mpm::Index gnid,
@@ -22,21 +45,26 @@ bool mpm::Mesh<Tdim>::create_nodes(mpm::Index gnid,
     // Check if nodal coordinates is empty
     if (coordinates.empty())
       throw std::runtime_error("List of coordinates is empty");
-    // Iterate over all coordinates
-    for (const auto& node_coordinates : coordinates) {
+    auto factory = Factory<mpm::NodeBase<Tdim>, mpm::Index,
+                           const Eigen::Matrix<double, Tdim, 1>&>::instance();
+    if (!factory->check(node_type))
+      throw std::runtime_error("Invalid node type: " + node_type);
+
+    // Create nodes, in NUMA-aware mode each thread of the static partition
+    // of node loops first touches its nodes
+    std::vector<std::shared_ptr<mpm::NodeBase<Tdim>>> nodes(coordinates.size());
+    const long nnodes = coordinates.size();
+#pragma omp parallel for schedule(static) if (numa_aware_)
+    for (long i = 0; i < nnodes; ++i)
+      nodes[i] = factory->create(node_type, static_cast<mpm::Index>(gnid + i),
+                                 coordinates[i]);
+
+    // Iterate over all nodes
+    for (const auto& node : nodes) {
       // Add node to mesh and check
-      bool insert_status = this->add_node(
-          // Create a node of particular
-          Factory<mpm::NodeBase<Tdim>, mpm::Index,
-                  const Eigen::Matrix<double, Tdim, 1>&>::instance()
-              ->create(node_type, static_cast<mpm::Index>(gnid),
-                       node_coordinates),
-          check_duplicates);
-
-      // Increment node id
-      if (insert_status) ++gnid;
+      bool insert_status = this->add_node(node, check_duplicates);
       // When addition of node fails
-      else
+      if (!insert_status)
         throw std::runtime_error("Addition of node to mesh failed!");
     }
   } catch (std::exception& exception) {
@@ -53,6 +81,7 @@ bool mpm::Mesh<Tdim>::add_node(const std::shared_ptr<mpm::NodeBase<Tdim>>& node,
   bool insertion_status = nodes_.add(node, check_duplicates);
   // Add node to map
   if (insertion_status) map_nodes_.insert(node->id(), node);
+  step_plan_valid_ = false;
   return insertion_status;
 }
 
@@ -61,6 +90,7 @@ template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::remove_node(
     const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
   const mpm::Index id = node->id();
+  step_plan_valid_ = false;
   // Remove a node if found in the container
   return (nodes_.remove(node) && map_nodes_.remove(id));
 }
@@ -69,18 +99,21 @@ bool mpm::Mesh<Tdim>::remove_node(
 template <unsigned Tdim>
 template <typename Toper>
 void mpm::Mesh<Tdim>::iterate_over_nodes(Toper oper) {
-#pragma omp parallel for schedule(runtime)
-  for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr) oper(*nitr);
+  mpm::parallel_for(
+      nodes_.cbegin(), nodes_.cend(), [&oper](auto nitr) { oper(*nitr); },
+      numa_aware_);
 }
 
 //! Iterate over nodes
 template <unsigned Tdim>
 template <typename Toper, typename Tpred>
 void mpm::Mesh<Tdim>::iterate_over_nodes_predicate(Toper oper, Tpred pred) {
-#pragma omp parallel for schedule(runtime)
-  for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr) {
-    if (pred(*nitr)) oper(*nitr);
-  }
+  mpm::parallel_for(
+      nodes_.cbegin(), nodes_.cend(),
+      [&oper, &pred](auto nitr) {
+        if (pred(*nitr)) oper(*nitr);
+      },
+      numa_aware_);
 }
 
 //! Create a list of active nodes in mesh
@@ -102,6 +135,124 @@ void mpm::Mesh<Tdim>::iterate_over_active_nodes(Toper oper) {
     oper(*nitr);
 }
 
+//! Update the per-step plan if the mesh topology has changed
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::update_step_plan() {
+  if (step_plan_valid_) return;
+
+  // Particles of each particle set present in the mesh
+  particle_set_particles_.clear();
+  for (const auto& pset : particle_sets_) {
+    auto& particles = particle_set_particles_[pset.first];
+    particles.reserve(pset.second.size());
+    for (const auto pid : pset.second)
+      if (map_particles_.find(pid) != map_particles_.end())
+        particles.emplace_back(map_particles_[pid]);
+  }
+
+  // Particles of each traction
+  traction_particles_.clear();
+  traction_particles_.resize(particle_tractions_.size());
+  std::set<mpm::Index> traction_pids;
+  for (unsigned i = 0; i < particle_tractions_.size(); ++i) {
+    const int set_id = particle_tractions_[i]->setid();
+    auto& particles = traction_particles_[i];
+    if (set_id == -1) {
+      particles.reserve(particles_.size());
+      for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
+        particles.emplace_back((*pitr).get());
+    } else {
+      const auto& pset = particle_set_particles_.at(set_id);
+      particles.reserve(pset.size());
+      for (const auto& particle : pset) particles.emplace_back(particle.get());
+    }
+    for (const auto particle : particles) traction_pids.insert(particle->id());
+  }
+  traction_force_particles_.clear();
+  traction_force_particles_.reserve(traction_pids.size());
+  for (const auto pid : traction_pids)
+    traction_force_particles_.emplace_back(map_particles_[pid].get());
+
+  // Cells of each injection on this rank
+  int mpi_rank = 0;
+#ifdef USE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
+  injection_cells_.clear();
+  injection_cells_.resize(particle_injections_.size());
+  for (unsigned i = 0; i < particle_injections_.size(); ++i) {
+    const int cset_id = particle_injections_[i].cell_set_id;
+    const auto& cset = (cset_id == -1) ? this->cells_ : cell_sets_.at(cset_id);
+    for (auto citr = cset.cbegin(); citr != cset.cend(); ++citr)
+      if ((*citr)->rank() == mpi_rank) injection_cells_[i].emplace_back(*citr);
+  }
+
+  // Particles are regrouped by material in the next stress update
+  material_particles_.clear();
+
+  // Initialise all nodes in the next step
+  step_nodes_.clear();
+  step_nodes_.reserve(nodes_.size());
+  for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr)
+    step_nodes_.emplace_back((*nitr).get());
+
+  step_plan_valid_ = true;
+}
+
+//! Initialise nodes used in the previous step and activate nodes
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::initialise_step_nodes() {
+  this->update_step_plan();
+
+  const auto initialise = [](auto nitr) { (*nitr)->initialise(); };
+  // Initialise nodes used in the previous step
+  mpm::parallel_for(step_nodes_.cbegin(), step_nodes_.cend(), initialise);
+
+  // Nodes with concentrated forces and shared nodes are reset every step
+  mpm::parallel_for(concentrated_force_nodes_.cbegin(),
+                    concentrated_force_nodes_.cend(), initialise);
+  mpm::parallel_for(domain_shared_nodes_.cbegin(), domain_shared_nodes_.cend(),
+                    initialise);
+
+  // Activate nodes of cells with particles
+  mpm::parallel_for(cells_.cbegin(), cells_.cend(),
+                    [](auto citr) { (*citr)->activate_nodes(); });
+
+  // Gather active nodes by chunks of nodes in parallel and join the chunks
+  const long nnodes = static_cast<long>(nodes_.size());
+  long nchunks = 1;
+#ifdef _OPENMP
+  nchunks = std::max(1L, std::min(nnodes, 4L * omp_get_max_threads()));
+#endif
+  std::vector<std::vector<NodeBase<Tdim>*>> chunk_nodes(nchunks);
+  const auto first_chunk = chunk_nodes.begin();
+  const auto first_node = nodes_.cbegin();
+  mpm::parallel_for(
+      chunk_nodes.begin(), chunk_nodes.end(),
+      [nnodes, nchunks, first_chunk, first_node](auto chunk) {
+        const long index = std::distance(first_chunk, chunk);
+        const auto begin = first_node + (nnodes * index) / nchunks;
+        const auto end = first_node + (nnodes * (index + 1)) / nchunks;
+        for (auto nitr = begin; nitr != end; ++nitr)
+          if ((*nitr)->status()) chunk->emplace_back((*nitr).get());
+      });
+  step_nodes_.clear();
+  for (const auto& nodes : chunk_nodes)
+    step_nodes_.insert(step_nodes_.end(), nodes.begin(), nodes.end());
+  mpm::Profiler::instance()->add_count("active_nodes", step_nodes_.size());
+}
+
+//! Apply concentrated forces on nodes with concentrated forces
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::apply_nodal_concentrated_forces(unsigned phase,
+                                                      double current_time) {
+  mpm::parallel_for(concentrated_force_nodes_.cbegin(),
+                    concentrated_force_nodes_.cend(),
+                    [phase, current_time](auto nitr) {
+                      (*nitr)->apply_concentrated_force(phase, current_time);
+                    });
+}
+
 #ifdef USE_MPI
 #ifdef USE_HALO_EXCHANGE
 //! Nodal halo exchange
@@ -110,6 +261,7 @@ template <typename Ttype, unsigned Tnparam, typename Tgetfunctor,
           typename Tsetfunctor>
 void mpm::Mesh<Tdim>::nodal_halo_exchange(Tgetfunctor getter,
                                           Tsetfunctor setter) {
+  mpm::ScopedTimer timer("halo_exchange");
   // Create vector of nodal vectors
   unsigned nnodes = this->domain_shared_nodes_.size();
 
@@ -168,6 +320,7 @@ template <typename Ttype, unsigned Tnparam, typename Tgetfunctor,
           typename Tsetfunctor>
 void mpm::Mesh<Tdim>::nodal_halo_exchange(Tgetfunctor getter,
                                           Tsetfunctor setter) {
+  mpm::ScopedTimer timer("halo_exchange");
   // Create vector of nodal scalars
   std::vector<Ttype> prop_get(nhalo_nodes_, mpm::zero<Ttype>());
   std::vector<Ttype> prop_set(nhalo_nodes_, mpm::zero<Ttype>());
@@ -243,7 +396,11 @@ bool mpm::Mesh<Tdim>::add_cell(const std::shared_ptr<mpm::Cell<Tdim>>& cell,
                                bool check_duplicates) {
   bool insertion_status = cells_.add(cell, check_duplicates);
   // Add cell to map
-  if (insertion_status) map_cells_.insert(cell->id(), cell);
+  if (insertion_status) {
+    map_cells_.insert(cell->id(), cell);
+    max_nfunctions_ = std::max(max_nfunctions_, cell->nfunctions());
+  }
+  step_plan_valid_ = false;
   return insertion_status;
 }
 
@@ -252,6 +409,7 @@ template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::remove_cell(
     const std::shared_ptr<mpm::Cell<Tdim>>& cell) {
   const mpm::Index id = cell->id();
+  step_plan_valid_ = false;
   // Remove a cell if found in the container
   return (cells_.remove(cell) && map_cells_.remove(id));
 }
@@ -293,86 +451,142 @@ void mpm::Mesh<Tdim>::find_nglobal_particles_cells() {
   int mpi_rank = 0;
 #ifdef USE_MPI
   MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
-  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
-    int nparticles;
-    // Determine the rank of the broadcast emitter process
-    if ((*citr)->rank() == mpi_rank) nparticles = (*citr)->nparticles();
-    MPI_Bcast(&nparticles, 1, MPI_INT, (*citr)->rank(), MPI_COMM_WORLD);
-    // Receive broadcast and update on all ranks
-    (*citr)->nglobal_particles(nparticles);
-  }
+  // Number of particles of the cells of this rank, reduced over all ranks
+  const long ncells = cells_.size();
+  std::vector<unsigned> nparticles(ncells, 0);
+#pragma omp parallel for schedule(runtime)
+  for (long i = 0; i < ncells; ++i)
+    if (cells_[i]->rank() == static_cast<unsigned>(mpi_rank))
+      nparticles[i] = cells_[i]->nparticles();
+
+  MPI_Allreduce(MPI_IN_PLACE, nparticles.data(), ncells, MPI_UNSIGNED,
+                MPI_SUM, MPI_COMM_WORLD);
+
+#pragma omp parallel for schedule(runtime)
+  for (long i = 0; i < ncells; ++i) cells_[i]->nglobal_particles(nparticles[i]);
 #endif
 }
 
 //! Find particle neighbours for all particle
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::find_particle_neighbours() {
+  this->build_cell_list();
+
+  int mpi_rank = 0;
+#ifdef USE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
+  // Local cells with particles
+  std::vector<std::shared_ptr<mpm::Cell<Tdim>>> cells;
   for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr)
+    if ((*citr)->rank() == mpi_rank && (*citr)->nparticles() > 0)
+      cells.emplace_back(*citr);
+
+  mpm::parallel_for(cells.cbegin(), cells.cend(), [this](auto citr) {
     this->find_particle_neighbours(*citr);
+  });
 }
 
 //! Find particle neighbours for specific cell particle
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::find_particle_neighbours(
     const std::shared_ptr<mpm::Cell<Tdim>>& cell) {
+  try {
+    // Particles of the current cell read their neighbours from the ranges
+    // of the cell and its neighbour cells in the cell list
+    for (auto particle_id : cell_list_->particles(cell->id()))
+      map_particles_[particle_id]->assign_neighbours(cell_list_);
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+  }
+}
+
+//! Build the cell list of particles in local cells and their neighbours
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::build_cell_list() {
   int mpi_rank = 0;
 #ifdef USE_MPI
   MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
 #endif
 
-  // Particles in current cell
-  std::vector<mpm::Index> neighbour_particles = cell->particles();
-  // Loop over all neighboring cells, and append particle ids from each cell
-  for (const auto& neighbour_cell_id : cell->neighbours()) {
-    // Get the MPI rank of the neighbour cell
-    int neighbour_cell_rank = map_cells_[neighbour_cell_id]->rank();
-    if (neighbour_cell_rank != cell->rank()) {
+  // Local cells, and cells of this rank to send to and receive from each
+  // neighbour rank in ascending order of cell ids
+  std::vector<std::shared_ptr<mpm::Cell<Tdim>>> local_cells;
+  std::map<int, std::set<mpm::Index>> send_cells, receive_cells;
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
+    if ((*citr)->rank() != static_cast<unsigned>(mpi_rank)) continue;
+    local_cells.emplace_back(*citr);
+    for (const auto neighbour_id : (*citr)->neighbours()) {
+      const int neighbour_rank = map_cells_[neighbour_id]->rank();
+      if (neighbour_rank != mpi_rank) {
+        send_cells[neighbour_rank].insert((*citr)->id());
+        receive_cells[neighbour_rank].insert(neighbour_id);
+      }
+    }
+  }
+
+  // Particle ids of neighbour cells on other ranks
+  std::map<mpm::Index, std::vector<mpm::Index>> ghost_particles;
 #ifdef USE_MPI
-      // Send particle ids
-      if (neighbour_cell_rank == mpi_rank) {
-        // Get particle ids from each cell
-        auto send_particle_ids = map_cells_[neighbour_cell_id]->particles();
-        // Get size of the particle ids
-        int pid_size = send_particle_ids.size();
-        // Send the size of the particles in cell
-        MPI_Send(&pid_size, 1, MPI_INT, cell->rank(), neighbour_cell_id,
-                 MPI_COMM_WORLD);
+  // One message per neighbour rank with the number of particles of each cell
+  // followed by the particle ids of the cells
+  std::vector<std::vector<mpm::Index>> send_buffers;
+  std::vector<MPI_Request> send_requests(send_cells.size());
+  send_buffers.reserve(send_cells.size());
+  for (const auto& send : send_cells) {
+    std::vector<mpm::Index> buffer;
+    for (const auto cell_id : send.second)
+      buffer.emplace_back(map_cells_[cell_id]->nparticles());
+    for (const auto cell_id : send.second) {
+      const auto& particle_ids = map_cells_[cell_id]->particles();
+      buffer.insert(buffer.end(), particle_ids.begin(), particle_ids.end());
+    }
+    send_buffers.emplace_back(std::move(buffer));
+    MPI_Isend(send_buffers.back().data(), send_buffers.back().size(),
+              MPI_UNSIGNED_LONG_LONG, send.first, 0, MPI_COMM_WORLD,
+              &send_requests[send_buffers.size() - 1]);
+  }
 
-        // Send particle ids if it is not empty
-        if (pid_size > 0)
-          MPI_Send(send_particle_ids.data(), pid_size, MPI_UNSIGNED_LONG_LONG,
-                   cell->rank(), neighbour_cell_id, MPI_COMM_WORLD);
-      }
-      // Receive particle ids in the current MPI rank
-      if (cell->rank() == mpi_rank) {
-        // Particle ids at local cell MPI rank
-        std::vector<mpm::Index> received_particle_ids;
-        int nparticles = 0;
-        MPI_Recv(&nparticles, 1, MPI_INT, neighbour_cell_rank,
-                 neighbour_cell_id, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-        if (nparticles > 0) {
-          received_particle_ids.resize(nparticles);
-          MPI_Recv(received_particle_ids.data(), nparticles,
-                   MPI_UNSIGNED_LONG_LONG, neighbour_cell_rank,
-                   neighbour_cell_id, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-        }
+  for (const auto& receive : receive_cells) {
+    MPI_Status status;
+    MPI_Probe(receive.first, 0, MPI_COMM_WORLD, &status);
+    int size = 0;
+    MPI_Get_count(&status, MPI_UNSIGNED_LONG_LONG, &size);
+    std::vector<mpm::Index> buffer(size);
+    MPI_Recv(buffer.data(), size, MPI_UNSIGNED_LONG_LONG, receive.first, 0,
+             MPI_COMM_WORLD, MPI_STATUS_IGNORE);
 
-        neighbour_particles.insert(neighbour_particles.end(),
-                                   received_particle_ids.begin(),
-                                   received_particle_ids.end());
-      }
-#endif
-    } else {
-      const auto& particle_ids = map_cells_[neighbour_cell_id]->particles();
-      neighbour_particles.insert(neighbour_particles.end(),
-                                 particle_ids.begin(), particle_ids.end());
+    auto pitr = buffer.cbegin() + receive.second.size();
+    unsigned i = 0;
+    for (const auto cell_id : receive.second) {
+      const auto nparticles = buffer[i++];
+      ghost_particles[cell_id].assign(pitr, pitr + nparticles);
+      pitr += nparticles;
     }
   }
+  MPI_Waitall(send_requests.size(), send_requests.data(), MPI_STATUSES_IGNORE);
+#endif
+
+  // Slots of local and ghost cells
+  cell_list_->clear();
+  for (const auto& cell : local_cells)
+    cell_list_->add_cell(cell->id(), cell->nparticles());
+  for (const auto& ghost : ghost_particles)
+    cell_list_->add_cell(ghost.first, ghost.second.size());
+  cell_list_->allocate();
 
-  // Assign neighbouring particle ids to particles in the current cell
-  for (auto particle_id : cell->particles())
-    map_particles_[particle_id]->assign_neighbours(neighbour_particles);
+  for (const auto& ghost : ghost_particles)
+    cell_list_->assign_particles(ghost.first, ghost.second.cbegin(),
+                                ghost.second.cend());
+
+  // Particles and neighbours of local cells
+  const auto assign = [this](auto citr) {
+    const auto particle_ids = (*citr)->particles();
+    cell_list_->assign_particles((*citr)->id(), particle_ids.cbegin(),
+                                particle_ids.cend());
+    cell_list_->assign_neighbours((*citr)->id(), (*citr)->neighbours());
+  };
+  mpm::parallel_for(local_cells.cbegin(), local_cells.cend(), assign);
 }
 
 //! Find ghost cell neighbours
@@ -481,33 +695,37 @@ bool mpm::Mesh<Tdim>::generate_material_points(
         materials.emplace_back(materials_.at(m_id));
 
       // If set id is -1, use all cells
-      auto cset = (cset_id == -1) ? this->cells_ : cell_sets_.at(cset_id);
+      const auto& cset =
+          (cset_id == -1) ? this->cells_ : cell_sets_.at(cset_id);
       // Iterate over each cell to generate points
+      std::vector<VectorDim> coordinates;
+      std::vector<std::shared_ptr<mpm::Cell<Tdim>>> cells;
       for (auto citr = cset.cbegin(); citr != cset.cend(); ++citr) {
         (*citr)->assign_quadrature(nquadratures);
         // Genereate particles at the Gauss points
         const auto cpoints = (*citr)->generate_points();
-        // Iterate over each coordinate to generate material points
-        for (const auto& coordinates : cpoints) {
-          // Particle id
-          mpm::Index pid = particles_.size();
-          // Create particle
-          auto particle =
-              Factory<mpm::ParticleBase<Tdim>, mpm::Index,
-                      const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                  ->create(particle_type, static_cast<mpm::Index>(pid),
-                           coordinates);
+        coordinates.insert(coordinates.end(), cpoints.begin(), cpoints.end());
+        cells.insert(cells.end(), cpoints.size(), *citr);
+      }
 
-          // Add particle to mesh
-          status = this->add_particle(particle, checks);
-          if (status) {
-            map_particles_[pid]->assign_cell(*citr);
-            for (unsigned phase = 0; phase < materials.size(); phase++)
-              map_particles_[pid]->assign_material(materials[phase], phase);
-            pids.emplace_back(pid);
-          } else
-            throw std::runtime_error("Generate particles in mesh failed");
-        }
+      // Create particles
+      const auto particles =
+          this->construct_particles(particle_type, particles_.size(),
+                                    coordinates);
+
+      // Iterate over each particle to generate material points
+      for (unsigned i = 0; i < particles.size(); ++i) {
+        // Particle id
+        const mpm::Index pid = particles[i]->id();
+        // Add particle to mesh
+        status = this->add_particle(particles[i], checks);
+        if (status) {
+          map_particles_[pid]->assign_cell(cells[i]);
+          for (unsigned phase = 0; phase < materials.size(); phase++)
+            map_particles_[pid]->assign_material(materials[phase], phase);
+          pids.emplace_back(pid);
+        } else
+          throw std::runtime_error("Generate particles in mesh failed");
       }
       if (before_generation == this->nparticles())
         throw std::runtime_error("No particles were generated!");
@@ -549,15 +767,14 @@ bool mpm::Mesh<Tdim>::create_particles(
     // Check if particle coordinates is empty
     if (coordinates.empty())
       throw std::runtime_error("List of coordinates is empty");
-    // Iterate over particle coordinates
-    for (const auto& particle_coordinates : coordinates) {
+    // Create particles
+    const auto particles =
+        this->construct_particles(particle_type, particles_.size(), coordinates);
+
+    // Iterate over particles
+    for (const auto& particle : particles) {
       // Particle id
-      mpm::Index pid = particles_.size();
-      // Create particle
-      auto particle = Factory<mpm::ParticleBase<Tdim>, mpm::Index,
-                              const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                          ->create(particle_type, static_cast<mpm::Index>(pid),
-                                   particle_coordinates);
+      const mpm::Index pid = particle->id();
 
       // Add particle to mesh and check
       bool insert_status = this->add_particle(particle, check_duplicates);
@@ -583,6 +800,40 @@ bool mpm::Mesh<Tdim>::create_particles(
   return status;
 }
 
+//! Create particles in the memory pools of threads
+template <unsigned Tdim>
+std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>>
+    mpm::Mesh<Tdim>::construct_particles(
+        const std::string& particle_type, mpm::Index first_id,
+        const std::vector<VectorDim>& coordinates) {
+  auto factory = Factory<mpm::ParticleBase<Tdim>, mpm::Index,
+                         const Eigen::Matrix<double, Tdim, 1>&>::instance();
+  if (!factory->check(particle_type))
+    throw std::runtime_error("Invalid particle type: " + particle_type);
+
+  std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>> particles(
+      coordinates.size());
+  const long nparticles = coordinates.size();
+#pragma omp parallel if (numa_aware_)
+  {
+    // Memory pool of the thread
+    auto pool = particle_pool_;
+#ifdef _OPENMP
+    const unsigned thread = omp_get_thread_num();
+    if (numa_aware_ && thread < particle_pools_.size())
+      pool = particle_pools_[thread];
+#endif
+    // Each thread of the static partition of particle loops first touches
+    // its particles
+#pragma omp for schedule(static)
+    for (long i = 0; i < nparticles; ++i)
+      particles[i] = factory->create(
+          particle_type, mpm::PoolAllocator<mpm::ParticleBase<Tdim>>(pool),
+          static_cast<mpm::Index>(first_id + i), coordinates[i]);
+  }
+  return particles;
+}
+
 //! Add a particle pointer to the mesh
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::add_particle(
@@ -606,6 +857,8 @@ bool mpm::Mesh<Tdim>::add_particle(
       map_particles_.insert(particle->id(), particle);
     }
     if (!status) throw std::runtime_error("Particle addition failed");
+    step_plan_valid_ = false;
+    shapefn_cache_->clear();
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
     status = false;
@@ -618,6 +871,8 @@ template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::remove_particle(
     const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
   const mpm::Index id = particle->id();
+  step_plan_valid_ = false;
+  shapefn_cache_->clear();
   // Remove associated cell for the particle
   map_particles_[id]->remove_cell();
   // Remove a particle if found in the container and map
@@ -627,6 +882,8 @@ bool mpm::Mesh<Tdim>::remove_particle(
 //! Remove a particle by id
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::remove_particle_by_id(mpm::Index id) {
+  step_plan_valid_ = false;
+  shapefn_cache_->clear();
   // Remove associated cell for the particle
   map_particles_[id]->remove_cell();
   bool result = particles_.remove(map_particles_[id]);
@@ -637,6 +894,8 @@ bool mpm::Mesh<Tdim>::remove_particle_by_id(mpm::Index id) {
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::remove_particles(const std::vector<mpm::Index>& pids) {
   if (!pids.empty()) {
+    step_plan_valid_ = false;
+    shapefn_cache_->clear();
     // Get MPI rank
     int mpi_size = 1;
 #ifdef USE_MPI
@@ -658,6 +917,27 @@ void mpm::Mesh<Tdim>::remove_particles(const std::vector<mpm::Index>& pids) {
   }
 }
 
+//! Remove the particles of a particle set present on this rank
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::remove_particle_set(unsigned set_id) {
+  bool status = true;
+  try {
+    if (particle_sets_.find(set_id) == particle_sets_.end())
+      throw std::runtime_error("No particle set found to remove particles");
+
+    // Particles of the set on other ranks are not in the map
+    std::vector<mpm::Index> pids;
+    for (const auto pid : particle_sets_.at(set_id))
+      if (map_particles_.find(pid) != map_particles_.end())
+        pids.emplace_back(pid);
+    this->remove_particles(pids);
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    status = false;
+  }
+  return status;
+}
+
 //! Remove all particles in a cell given cell id
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::remove_all_nonrank_particles() {
@@ -690,11 +970,14 @@ void mpm::Mesh<Tdim>::remove_all_nonrank_particles() {
   particles_.reserve(static_cast<int>(nparticles / mpi_size));
   // Iterate over the map of particles and add them to container
   for (auto& particle : map_particles_) particles_.add(particle.second, false);
+  step_plan_valid_ = false;
+  shapefn_cache_->clear();
 }
 
 //! Transfer all particles in cells that are not in local rank
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::transfer_halo_particles() {
+  mpm::ScopedTimer timer("migration");
 #ifdef USE_MPI
   // Get number of MPI ranks
   int mpi_size;
@@ -730,12 +1013,14 @@ void mpm::Mesh<Tdim>::transfer_halo_particles() {
         std::vector<uint8_t> buffer = map_particles_[id]->serialize();
         MPI_Send(buffer.data(), buffer.size(), MPI_UINT8_T, (*citr)->rank(), 0,
                  MPI_COMM_WORLD);
+        mpm::Profiler::instance()->add_count("bytes_sent", buffer.size());
         ++np;
         // Particles to be removed from the current rank
         remove_pids.emplace_back(id);
       }
       (*citr)->clear_particle_ids();
     }
+    mpm::Profiler::instance()->add_count("migrated_particles", np);
     // Remove all sent particles
     this->remove_particles(remove_pids);
     // Send complete
@@ -807,8 +1092,10 @@ void mpm::Mesh<Tdim>::transfer_halo_particles() {
         auto particle =
             Factory<mpm::ParticleBase<Tdim>, mpm::Index,
                     const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                ->create(particle_type, static_cast<mpm::Index>(pid),
-                         pcoordinates);
+                ->create(particle_type,
+                         mpm::PoolAllocator<mpm::ParticleBase<Tdim>>(
+                             particle_pool_),
+                         static_cast<mpm::Index>(pid), pcoordinates);
         particle->deserialize(buffer, materials);
         // Add particle to mesh
         this->add_particle(particle, true);
@@ -822,6 +1109,7 @@ void mpm::Mesh<Tdim>::transfer_halo_particles() {
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::transfer_nonrank_particles(
     const std::vector<mpm::Index>& exchange_cells) {
+  mpm::ScopedTimer timer("migration");
 #ifdef USE_MPI
   // Get number of MPI ranks
   int mpi_size;
@@ -857,6 +1145,7 @@ void mpm::Mesh<Tdim>::transfer_nonrank_particles(
           std::vector<uint8_t> buffer = map_particles_[id]->serialize();
           MPI_Ibsend(buffer.data(), buffer.size(), MPI_UINT8_T, cell->rank(), 0,
                      MPI_COMM_WORLD, &send_particle_requests[np]);
+          mpm::Profiler::instance()->add_count("bytes_sent", buffer.size());
           ++np;
 
           // Particles to be removed from the current rank
@@ -866,6 +1155,7 @@ void mpm::Mesh<Tdim>::transfer_nonrank_particles(
         ++nsend_requests;
       }
     }
+    mpm::Profiler::instance()->add_count("migrated_particles", np);
     // Remove all sent particles
     this->remove_particles(remove_pids);
     // Send complete iterate only upto valid send requests
@@ -937,8 +1227,10 @@ void mpm::Mesh<Tdim>::transfer_nonrank_particles(
           auto particle =
               Factory<mpm::ParticleBase<Tdim>, mpm::Index,
                       const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                  ->create(particle_type, static_cast<mpm::Index>(pid),
-                           pcoordinates);
+                  ->create(particle_type,
+                           mpm::PoolAllocator<mpm::ParticleBase<Tdim>>(
+                               particle_pool_),
+                           static_cast<mpm::Index>(pid), pcoordinates);
           particle->deserialize(buffer, materials);
           // Add particle to mesh
           this->add_particle(particle, true);
@@ -952,6 +1244,7 @@ void mpm::Mesh<Tdim>::transfer_nonrank_particles(
 //! Find shared nodes across MPI domains
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::find_domain_shared_nodes() {
+  step_plan_valid_ = false;
   // Clear MPI rank at the nodes
 #pragma omp parallel for schedule(runtime)
   for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr)
@@ -1043,6 +1336,8 @@ bool mpm::Mesh<Tdim>::locate_particle_cells(
     }
   }
 
+  // Search all cells
+  mpm::Profiler::instance()->add_count("full_search_locations", 1);
   bool status = false;
 #pragma omp parallel for schedule(runtime)
   for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
@@ -1063,9 +1358,9 @@ bool mpm::Mesh<Tdim>::locate_particle_cells(
 template <unsigned Tdim>
 template <typename Toper>
 void mpm::Mesh<Tdim>::iterate_over_particles(Toper oper) {
-#pragma omp parallel for schedule(runtime)
-  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
-    oper(*pitr);
+  mpm::parallel_for(
+      particles_.cbegin(), particles_.cend(),
+      [&oper](auto pitr) { oper(*pitr); }, numa_aware_);
 }
 
 //! Iterate over particle set
@@ -1076,14 +1371,176 @@ void mpm::Mesh<Tdim>::iterate_over_particle_set(int set_id, Toper oper) {
   if (set_id == -1) {
     this->iterate_over_particles(oper);
   } else {
-    // Iterate over the particle set
-    auto set = particle_sets_.at(set_id);
+    // Iterate over the particles of the set
+    this->update_step_plan();
+    const auto& particles = particle_set_particles_.at(set_id);
+    mpm::parallel_for(particles.cbegin(), particles.cend(),
+                      [&oper](auto pitr) { oper(*pitr); });
+  }
+}
+
+//! Compute strains of particles
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::compute_particle_strains(double dt) {
+  // Cells with particles
+  std::vector<mpm::Cell<Tdim>*> cells;
+  cells.reserve(cells_.size());
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr)
+    if ((*citr)->nparticles() > 0) cells.emplace_back((*citr).get());
+
+  // Volumetric strain rate at the centroid once per cell
+  mpm::parallel_for(cells.cbegin(), cells.cend(), [](auto citr) {
+    (*citr)->compute_volumetric_strain_rate_centroid(mpm::ParticlePhase::Solid);
+  });
+
+  // Iterate over each particle to calculate strain
+  this->iterate_over_particles(std::bind(
+      &mpm::ParticleBase<Tdim>::compute_strain, std::placeholders::_1, dt));
+
+  // Nodal velocities change in the next step
+  mpm::parallel_for(cells.cbegin(), cells.cend(), [](auto citr) {
+    (*citr)->reset_volumetric_strain_rate_centroid();
+  });
+}
+
+//! Compute shape functions of particles in the shape function cache
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::compute_shapefn() {
+  // Stride of the cache is the largest number of shape functions of a cell
+  shapefn_cache_->resize(particles_.size(), max_nfunctions_, Tdim);
+
+  const auto first = particles_.cbegin();
+  mpm::parallel_for(
+      first, particles_.cend(),
+      [this, first](auto pitr) {
+        (*pitr)->assign_shapefn_cache(shapefn_cache_,
+                                      std::distance(first, pitr));
+        (*pitr)->compute_shapefn();
+      },
+      numa_aware_);
+}
+
+//! Compute the critical time step of particles
+template <unsigned Tdim>
+double mpm::Mesh<Tdim>::critical_time_step(
+    const std::map<unsigned, double>& wave_speeds, unsigned phase) const {
+  double dt_critical = std::numeric_limits<double>::max();
+#pragma omp parallel for schedule(runtime) reduction(min : dt_critical)
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
+    const double length = (*citr)->mean_length();
+    for (const auto pid : (*citr)->particles()) {
+      const auto& particle = map_particles_[pid];
+      const auto speed = wave_speeds.find(particle->material_id(phase));
+      // Wave speed and particle speed
+      const double celerity =
+          ((speed != wave_speeds.end()) ? speed->second : 0.) +
+          particle->velocity().norm();
+      if (celerity > 0.) dt_critical = std::min(dt_critical, length / celerity);
+    }
+  }
+  return dt_critical;
+}
+
+//! Compute the kinetic energy of particles
+template <unsigned Tdim>
+double mpm::Mesh<Tdim>::kinetic_energy() const {
+  double energy = 0.;
+#pragma omp parallel for schedule(runtime) reduction(+ : energy)
+  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
+    energy += 0.5 * (*pitr)->mass() * (*pitr)->velocity().squaredNorm();
+  return energy;
+}
+
+//! Compute the squared norms of the unbalanced and external nodal forces
+template <unsigned Tdim>
+std::pair<double, double> mpm::Mesh<Tdim>::unbalanced_force_norms(
+    unsigned phase) const {
+  double unbalanced = 0.;
+  double external = 0.;
+#pragma omp parallel for schedule(runtime) reduction(+ : unbalanced, external)
+  for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr) {
+    // Nodes shared by MPI ranks count once in the sums over ranks
+    const double weight =
+        1. / std::max<std::size_t>(1, (*nitr)->mpi_ranks().size());
+    unbalanced += weight * (*nitr)->unbalanced_force(phase).squaredNorm();
+    external += weight * (*nitr)->external_force(phase).squaredNorm();
+  }
+  return std::make_pair(unbalanced, external);
+}
+
+//! Compute stresses of particles in batches sharing a material
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::compute_particle_stresses(unsigned phase) {
+  // Number of particles in a batch
+  const unsigned batch_size = 256;
+
+  // Groups of particles by material of the step plan, which are regrouped if
+  // materials of particles have changed
+  this->update_step_plan();
+  auto& groups = material_particles_[phase];
+  std::size_t ngrouped = 0;
+  for (const auto& group : groups) ngrouped += group.size();
+  bool grouped = (ngrouped == particles_.size());
+  for (const auto& group : groups) {
+    if (!grouped) break;
+    const unsigned material_id = group.front()->material_id(phase);
+#pragma omp parallel for schedule(static) reduction(&& : grouped)
+    for (long i = 0; i < static_cast<long>(group.size()); ++i)
+      grouped = grouped && (group[i]->material_id(phase) == material_id);
+  }
+  if (!grouped) {
+    std::map<unsigned, std::vector<mpm::ParticleBase<Tdim>*>> materials;
+    for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
+      if ((*pitr)->material(phase) == nullptr)
+        throw std::runtime_error("Particle " + std::to_string((*pitr)->id()) +
+                                 " has no material for the stress update");
+      materials[(*pitr)->material_id(phase)].emplace_back((*pitr).get());
+    }
+    groups.clear();
+    for (auto& material : materials)
+      groups.emplace_back(std::move(material.second));
+  }
+
+  // Split groups into batches of particles
+  struct Batch {
+    //! Material of the particles
+    mpm::Material<Tdim>* material;
+    //! First particle of the batch
+    mpm::ParticleBase<Tdim>* const* particles;
+    //! Number of particles
+    unsigned nparticles;
+  };
+  std::vector<Batch> batches;
+  for (const auto& particles : groups) {
+    auto material = particles.front()->material(phase).get();
+    for (unsigned begin = 0; begin < particles.size(); begin += batch_size)
+      batches.emplace_back(
+          Batch{material, particles.data() + begin,
+                std::min(batch_size,
+                         static_cast<unsigned>(particles.size()) - begin)});
+  }
+
 #pragma omp parallel for schedule(runtime)
-    for (auto sitr = set.begin(); sitr != set.cend(); ++sitr) {
-      unsigned pid = (*sitr);
-      if (map_particles_.find(pid) != map_particles_.end())
-        oper(map_particles_[pid]);
+  for (unsigned b = 0; b < batches.size(); ++b) {
+    const auto& batch = batches[b];
+    // Gather stresses, strain increments and state variables
+    Eigen::Matrix<double, 6, Eigen::Dynamic> stresses(6, batch.nparticles);
+    Eigen::Matrix<double, 6, Eigen::Dynamic> dstrains(6, batch.nparticles);
+    std::vector<const mpm::ParticleBase<Tdim>*> particles(batch.nparticles);
+    std::vector<mpm::dense_map*> state_vars(batch.nparticles);
+    for (unsigned i = 0; i < batch.nparticles; ++i) {
+      auto particle = batch.particles[i];
+      stresses.col(i) = particle->stress();
+      dstrains.col(i) = particle->dstrain();
+      particles[i] = particle;
+      state_vars[i] = particle->state_variables_ptr(phase);
     }
+    // Update stresses of the batch
+    batch.material->compute_stresses(&stresses, dstrains, particles,
+                                     state_vars);
+    // Scatter stresses
+    for (unsigned i = 0; i < batch.nparticles; ++i)
+      batch.particles[i]->update_stress(stresses.col(i));
   }
 }
 
@@ -1125,11 +1582,15 @@ std::vector<Eigen::Matrix<double, 3, 1>>
 template <unsigned Tdim>
 std::vector<double> mpm::Mesh<Tdim>::particles_scalar_data(
     const std::string& attribute) const {
-  std::vector<double> scalar_data;
-  scalar_data.reserve(particles_.size());
+  // Resolve the attribute once for all particles
+  const auto accessor = mpm::ParticleBase<Tdim>::scalar_accessor(attribute);
+  std::vector<double> scalar_data(particles_.size(),
+                                  std::numeric_limits<double>::quiet_NaN());
+  if (accessor == nullptr) return scalar_data;
   // Iterate over particles and add scalar value to data
-  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
-    scalar_data.emplace_back((*pitr)->scalar_data(attribute));
+  mpm::Index i = 0;
+  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr, ++i)
+    scalar_data[i] = ((*pitr).get()->*accessor)();
   return scalar_data;
 }
 
@@ -1137,18 +1598,17 @@ std::vector<double> mpm::Mesh<Tdim>::particles_scalar_data(
 template <unsigned Tdim>
 std::vector<Eigen::Matrix<double, 3, 1>> mpm::Mesh<Tdim>::particles_vector_data(
     const std::string& attribute) const {
-  std::vector<Eigen::Matrix<double, 3, 1>> vector_data;
-  // Iterate over particles
-  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
-    Eigen::Matrix<double, 3, 1> data;
-    data.setZero();
-    auto pdata = (*pitr)->vector_data(attribute);
-    // Fill vector_data to the size of dimensions
-    for (unsigned i = 0; i < pdata.size(); ++i) data(i) = pdata(i);
-
-    // Add to a tensor of data
-    vector_data.emplace_back(data);
-  }
+  // Resolve the attribute once for all particles
+  const auto accessor = mpm::ParticleBase<Tdim>::vector_accessor(attribute);
+  Eigen::Matrix<double, 3, 1> invalid = Eigen::Matrix<double, 3, 1>::Zero();
+  invalid.head(Tdim).fill(std::numeric_limits<double>::quiet_NaN());
+  std::vector<Eigen::Matrix<double, 3, 1>> vector_data(particles_.size(),
+                                                       invalid);
+  if (accessor == nullptr) return vector_data;
+  // Iterate over particles and fill vector_data to the size of dimensions
+  mpm::Index i = 0;
+  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr, ++i)
+    vector_data[i].head(Tdim) = ((*pitr).get()->*accessor)();
   return vector_data;
 }
 
@@ -1157,18 +1617,20 @@ template <unsigned Tdim>
 template <unsigned Tsize>
 std::vector<Eigen::Matrix<double, Tsize, 1>>
     mpm::Mesh<Tdim>::particles_tensor_data(const std::string& attribute) const {
-  std::vector<Eigen::Matrix<double, Tsize, 1>> tensor_data;
-  // Iterate over particles
-  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
-    Eigen::Matrix<double, Tsize, 1> data;
-    data.setZero();
-    auto pdata = (*pitr)->tensor_data(attribute);
-    // Fill tensor_data to the size of dimensions
-    for (unsigned i = 0; i < pdata.size(); ++i) data(i) = pdata(i);
-
-    // Add to a tensor of data
-    tensor_data.emplace_back(data);
-  }
+  // Resolve the attribute once for all particles
+  const auto accessor = mpm::ParticleBase<Tdim>::tensor_accessor(attribute);
+  Eigen::Matrix<double, Tsize, 1> invalid =
+      Eigen::Matrix<double, Tsize, 1>::Zero();
+  invalid.head(std::min(Tsize, 6u))
+      .fill(std::numeric_limits<double>::quiet_NaN());
+  std::vector<Eigen::Matrix<double, Tsize, 1>> tensor_data(particles_.size(),
+                                                           invalid);
+  if (accessor == nullptr) return tensor_data;
+  // Iterate over particles and fill tensor_data to the size of tensor
+  mpm::Index i = 0;
+  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr, ++i)
+    tensor_data[i].head(std::min(Tsize, 6u)) =
+        ((*pitr).get()->*accessor)().head(std::min(Tsize, 6u));
   return tensor_data;
 }
 
@@ -1251,11 +1713,12 @@ bool mpm::Mesh<Tdim>::create_particles_tractions(
     double traction) {
   bool status = true;
   try {
-    if (set_id == -1 || particle_sets_.find(set_id) != particle_sets_.end())
+    if (set_id == -1 || particle_sets_.find(set_id) != particle_sets_.end()) {
       // Create a particle traction load
       particle_tractions_.emplace_back(
           std::make_shared<mpm::Traction>(set_id, mfunction, dir, traction));
-    else
+      step_plan_valid_ = false;
+    } else
       throw std::runtime_error("No particle set found to assign traction");
 
   } catch (std::exception& exception) {
@@ -1268,19 +1731,24 @@ bool mpm::Mesh<Tdim>::create_particles_tractions(
 //! Apply particle tractions
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::apply_traction_on_particles(double current_time) {
+  if (particle_tractions_.empty()) return;
+  this->update_step_plan();
+
   // Iterate over all particle tractions
-  for (const auto& ptraction : particle_tractions_) {
-    int set_id = ptraction->setid();
-    unsigned dir = ptraction->dir();
-    double traction = ptraction->traction(current_time);
-    this->iterate_over_particle_set(
-        set_id, std::bind(&mpm::ParticleBase<Tdim>::assign_traction,
-                          std::placeholders::_1, dir, traction));
-  }
-  if (!particle_tractions_.empty()) {
-    this->iterate_over_particles(std::bind(
-        &mpm::ParticleBase<Tdim>::map_traction_force, std::placeholders::_1));
+  for (unsigned i = 0; i < particle_tractions_.size(); ++i) {
+    const unsigned dir = particle_tractions_[i]->dir();
+    const double traction = particle_tractions_[i]->traction(current_time);
+    const auto& particles = traction_particles_[i];
+    mpm::parallel_for(particles.cbegin(), particles.cend(),
+                      [dir, traction](auto pitr) {
+                        (*pitr)->assign_traction(dir, traction);
+                      });
   }
+
+  // Map traction forces of particles with tractions
+  mpm::parallel_for(traction_force_particles_.cbegin(),
+                    traction_force_particles_.cend(),
+                    [](auto pitr) { (*pitr)->map_traction_force(); });
 }
 
 //! Create particle velocity constraints
@@ -1323,6 +1791,14 @@ void mpm::Mesh<Tdim>::apply_particle_velocity_constraints() {
   }
 }
 
+//! Clear nodal and particle velocity constraints
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::clear_boundary_conditions() {
+  this->iterate_over_nodes(std::bind(&mpm::NodeBase<Tdim>::clear_constraints,
+                                     std::placeholders::_1));
+  particle_velocity_constraints_.clear();
+}
+
 //! Assign node tractions
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::assign_nodal_concentrated_forces(
@@ -1338,8 +1814,7 @@ bool mpm::Mesh<Tdim>::assign_nodal_concentrated_forces(
           "force");
 
     // Set id of -1, is all nodes
-    Vector<NodeBase<Tdim>> nodes =
-        (set_id == -1) ? this->nodes_ : node_sets_.at(set_id);
+    const auto& nodes = (set_id == -1) ? this->nodes_ : node_sets_.at(set_id);
 
 #pragma omp parallel for schedule(runtime)
     for (auto nitr = nodes.cbegin(); nitr != nodes.cend(); ++nitr) {
@@ -1347,6 +1822,15 @@ bool mpm::Mesh<Tdim>::assign_nodal_concentrated_forces(
                                               mfunction))
         throw std::runtime_error("Setting concentrated force failed");
     }
+    // Nodes to apply concentrated forces
+    std::set<mpm::Index> node_ids;
+    for (auto nitr = concentrated_force_nodes_.cbegin();
+         nitr != concentrated_force_nodes_.cend(); ++nitr)
+      node_ids.insert((*nitr)->id());
+    for (auto nitr = nodes.cbegin(); nitr != nodes.cend(); ++nitr)
+      if (node_ids.insert((*nitr)->id()).second)
+        concentrated_force_nodes_.add(*nitr, false);
+    step_plan_valid_ = false;
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
     status = false;
@@ -1428,20 +1912,33 @@ std::vector<std::array<mpm::Index, 2>> mpm::Mesh<Tdim>::particles_cells()
 //! Write particles to HDF5
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::write_particles_hdf5(unsigned phase,
-                                           const std::string& filename) {
+                                           const std::string& filename,
+                                           bool single_precision) {
   const unsigned nparticles = this->nparticles();
 
-  std::vector<HDF5Particle> particle_data;  // = new HDF5Particle[nparticles];
-  particle_data.reserve(nparticles);
+  // Number of state variables of the materials
+  unsigned nstate_vars = 0;
+  for (const auto& material : materials_)
+    nstate_vars = std::max(
+        nstate_vars,
+        static_cast<unsigned>(material.second->state_variables().size()));
 
-  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
-    particle_data.emplace_back((*pitr)->hdf5());
+  // Record layout with only the fields of the dimension
+  mpm::hdf5::particle::CompactLayout layout(Tdim, nstate_vars,
+                                            single_precision);
+  const size_t record_size = layout.record_size();
+
+  std::vector<char> particle_data(nparticles * record_size);
+
+  unsigned i = 0;
+  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
+    layout.pack((*pitr)->hdf5(), particle_data.data() + i * record_size);
+    ++i;
+  }
 
   // Calculate the size and the offsets of our struct members in memory
   const hsize_t NRECORDS = nparticles;
 
-  const hsize_t NFIELDS = mpm::hdf5::particle::NFIELDS;
-
   hid_t file_id;
   hsize_t chunk_size = 10000;
   int* fill_data = NULL;
@@ -1452,17 +1949,70 @@ bool mpm::Mesh<Tdim>::write_particles_hdf5(unsigned phase,
       H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
 
   // make a table
-  H5TBmake_table(
-      "Table Title", file_id, "table", NFIELDS, NRECORDS,
-      mpm::hdf5::particle::dst_size, mpm::hdf5::particle::field_names,
-      mpm::hdf5::particle::dst_offset, mpm::hdf5::particle::field_type,
-      chunk_size, fill_data, compress, particle_data.data());
+  H5TBmake_table("Table Title", file_id, "table", layout.nfields(), NRECORDS,
+                 record_size, layout.field_names(), layout.offsets(),
+                 layout.field_types(), chunk_size, fill_data, compress,
+                 particle_data.data());
+
+  // Schema of the table
+  const int version = mpm::hdf5::particle::SCHEMA_VERSION;
+  const unsigned dim = Tdim;
+  H5LTset_attribute_int(file_id, "table", "schema_version", &version, 1);
+  H5LTset_attribute_uint(file_id, "table", "dimension", &dim, 1);
+  H5LTset_attribute_uint(file_id, "table", "nstate_vars", &nstate_vars, 1);
+  const unsigned real_size = layout.real_size();
+  H5LTset_attribute_uint(file_id, "table", "real_size", &real_size, 1);
+
+  // Names of state variables of each material
+  for (const auto& material : materials_) {
+    std::string names;
+    for (const auto& state_var : material.second->state_variables())
+      names += (names.empty() ? "" : ",") + state_var;
+    const std::string attribute =
+        "state_vars_" + std::to_string(material.first);
+    H5LTset_attribute_string(file_id, "table", attribute.c_str(),
+                             names.c_str());
+  }
 
   H5Fclose(file_id);
   return true;
 }
 
-//! Write particles to HDF5
+//! Write the partition and the particles of cells to HDF5
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::write_particles_cells_hdf5(
+    const std::string& filename) const {
+  hid_t file_id = H5Fopen(filename.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+  if (file_id < 0) {
+    console_->error("{} #{}: HDF5 file {} is not found", __FILE__, __LINE__,
+                    filename);
+    return false;
+  }
+
+  // Id, rank and number of particles of cells, and particles of cells
+  std::vector<mpm::Index> cells_data;
+  cells_data.reserve(cells_.size() * 3);
+  std::vector<mpm::Index> cell_particles;
+  cell_particles.reserve(this->nparticles());
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
+    const auto pids = (*citr)->particles();
+    cells_data.emplace_back((*citr)->id());
+    cells_data.emplace_back((*citr)->rank());
+    cells_data.emplace_back(pids.size());
+    cell_particles.insert(cell_particles.end(), pids.begin(), pids.end());
+  }
+  const hsize_t cells_dims[2] = {cells_.size(), 3};
+  H5LTmake_dataset(file_id, "cells", 2, cells_dims, H5T_NATIVE_ULLONG,
+                   cells_data.data());
+  const hsize_t particles_dims[1] = {cell_particles.size()};
+  H5LTmake_dataset(file_id, "cell_particles", 1, particles_dims,
+                   H5T_NATIVE_ULLONG, cell_particles.data());
+
+  H5Fclose(file_id);
+  return true;
+}
+
+//! Read particles from HDF5
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::read_particles_hdf5(unsigned phase,
                                           const std::string& filename) {
@@ -1477,15 +2027,107 @@ bool mpm::Mesh<Tdim>::read_particles_hdf5(unsigned phase,
   hsize_t nfields = 0;
   H5TBget_table_info(file_id, "table", &nfields, &nrecords);
 
-  if (nfields != mpm::hdf5::particle::NFIELDS)
-    throw std::runtime_error("HDF5 table has incorrect number of fields");
+  std::vector<HDF5Particle> dst_buf(nrecords);
+  // Names of state variables stored for each material
+  std::map<unsigned, std::vector<std::string>> state_vars;
+
+  if (H5Aexists_by_name(file_id, "table", "schema_version", H5P_DEFAULT) > 0) {
+    // Compact table
+    int version = 0;
+    unsigned dim = 0, nstate_vars = 0;
+    H5LTget_attribute_int(file_id, "table", "schema_version", &version);
+    H5LTget_attribute_uint(file_id, "table", "dimension", &dim);
+    H5LTget_attribute_uint(file_id, "table", "nstate_vars", &nstate_vars);
+    if (version != mpm::hdf5::particle::SCHEMA_VERSION)
+      throw std::runtime_error("HDF5 table has an unknown schema version");
+    if (dim != Tdim)
+      throw std::runtime_error("HDF5 table has incorrect dimension");
+
+    // Size of real fields, tables without it are in double precision
+    unsigned real_size = sizeof(double);
+    if (H5Aexists_by_name(file_id, "table", "real_size", H5P_DEFAULT) > 0)
+      H5LTget_attribute_uint(file_id, "table", "real_size", &real_size);
+    if (real_size != sizeof(double) && real_size != sizeof(float))
+      throw std::runtime_error("HDF5 table has an invalid real size");
+
+    mpm::hdf5::particle::CompactLayout layout(dim, nstate_vars,
+                                              real_size == sizeof(float));
+    if (nfields != layout.nfields())
+      throw std::runtime_error("HDF5 table has incorrect number of fields");
+
+    // Read the table
+    const size_t record_size = layout.record_size();
+    std::vector<char> records(nrecords * record_size);
+    H5TBread_table(file_id, "table", record_size, layout.offsets(),
+                   layout.sizes(), records.data());
+    for (hsize_t i = 0; i < nrecords; ++i)
+      layout.unpack(records.data() + i * record_size, &dst_buf[i]);
+
+    // Read names of state variables
+    for (const auto& material : materials_) {
+      const std::string attribute =
+          "state_vars_" + std::to_string(material.first);
+      if (H5Aexists_by_name(file_id, "table", attribute.c_str(),
+                            H5P_DEFAULT) <= 0)
+        continue;
+      hsize_t dims = 0;
+      H5T_class_t type_class;
+      size_t type_size = 0;
+      H5LTget_attribute_info(file_id, "table", attribute.c_str(), &dims,
+                             &type_class, &type_size);
+      std::vector<char> names(type_size + 1, '\0');
+      H5LTget_attribute_string(file_id, "table", attribute.c_str(),
+                               names.data());
+      std::vector<std::string> svars;
+      std::stringstream stream(std::string(names.data()));
+      std::string name;
+      while (std::getline(stream, name, ',')) svars.emplace_back(name);
+      state_vars[material.first] = svars;
+    }
+  } else {
+    // Table with all fields
+    if (nfields != mpm::hdf5::particle::NFIELDS)
+      throw std::runtime_error("HDF5 table has incorrect number of fields");
+
+    // Read the table
+    H5TBread_table(file_id, "table", mpm::hdf5::particle::dst_size,
+                   mpm::hdf5::particle::dst_offset,
+                   mpm::hdf5::particle::dst_sizes, dst_buf.data());
+  }
+  // close the file
+  H5Fclose(file_id);
+
+  // Order state variables as in the current material, initial state variables
+  // are kept if any is missing in the file
+  std::vector<bool> restore_state_vars(nrecords, true);
+  for (hsize_t i = 0; i < nrecords; ++i) {
+    auto& particle = dst_buf[i];
+    if (state_vars.find(particle.material_id) == state_vars.end()) continue;
+    const auto& stored = state_vars.at(particle.material_id);
+    const auto current =
+        materials_.at(particle.material_id)->state_variables();
+    double svars[mpm::hdf5::particle::NSTATE_VARS] = {0};
+    bool found = (current.size() <= mpm::hdf5::particle::NSTATE_VARS);
+    for (unsigned j = 0; j < current.size() && found; ++j) {
+      auto itr = std::find(stored.begin(), stored.end(), current[j]);
+      found = (itr != stored.end());
+      if (found) svars[j] = particle.svars[itr - stored.begin()];
+    }
+    restore_state_vars[i] = found;
+    if (!found) continue;
+    particle.nstate_vars = current.size();
+    std::copy(std::begin(svars), std::end(svars), std::begin(particle.svars));
+  }
 
-  std::vector<HDF5Particle> dst_buf;
-  dst_buf.reserve(nrecords);
-  // Read the table
-  H5TBread_table(file_id, "table", mpm::hdf5::particle::dst_size,
-                 mpm::hdf5::particle::dst_offset,
-                 mpm::hdf5::particle::dst_sizes, dst_buf.data());
+  return this->initialise_particles_hdf5(dst_buf, restore_state_vars);
+}
+
+//! Initialise particles from HDF5 particles
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::initialise_particles_hdf5(
+    const std::vector<mpm::HDF5Particle>& hdf5_particles,
+    const std::vector<bool>& restore_state_vars) {
+  const size_t nrecords = hdf5_particles.size();
 
   // Vector of particles
   Vector<ParticleBase<Tdim>> particles;
@@ -1496,22 +2138,26 @@ bool mpm::Mesh<Tdim>::read_particles_hdf5(unsigned phase,
   unsigned i = 0;
   for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
     if (i < nrecords) {
-      HDF5Particle particle = dst_buf[i];
+      HDF5Particle particle = hdf5_particles[i];
       // Get particle's material from list of materials
       auto material = materials_.at(particle.material_id);
       // Initialise particle with HDF5 data
       (*pitr)->initialise_particle(particle, material);
+      // Initial state variables of the material
+      if (i < restore_state_vars.size() && !restore_state_vars[i])
+        (*pitr)->assign_material_state_vars(
+            material->initialise_state_variables(), material);
       // Add particle to map
       map_particles_.insert(particle.id, *pitr);
       particles.add(*pitr);
       ++i;
     }
   }
-  // close the file
-  H5Fclose(file_id);
 
   // Overwrite particles container
   this->particles_ = particles;
+  step_plan_valid_ = false;
+  shapefn_cache_->clear();
 
   // Remove associated cell for the particle
   for (auto citr = this->cells_.cbegin(); citr != this->cells_.cend(); ++citr)
@@ -1520,6 +2166,101 @@ bool mpm::Mesh<Tdim>::read_particles_hdf5(unsigned phase,
   return true;
 }
 
+//! Restore the partition and the particles of cells from HDF5
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::read_particles_cells_hdf5(
+    const std::string& filename,
+    std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>>*
+        unlocatable_particles) {
+  hid_t file_id = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (file_id < 0) throw std::runtime_error("HDF5 particle file is not found");
+
+  // Files without cells are located by a search
+  if (H5LTfind_dataset(file_id, "cells") <= 0 ||
+      H5LTfind_dataset(file_id, "cell_particles") <= 0) {
+    H5Fclose(file_id);
+    return false;
+  }
+
+  // Read cells and particles of cells
+  hsize_t cells_dims[2] = {0, 0};
+  H5LTget_dataset_info(file_id, "cells", cells_dims, nullptr, nullptr);
+  hsize_t particles_dims[1] = {0};
+  H5LTget_dataset_info(file_id, "cell_particles", particles_dims, nullptr,
+                       nullptr);
+  std::vector<mpm::Index> cells_data(cells_dims[0] * cells_dims[1]);
+  std::vector<mpm::Index> cell_particles(particles_dims[0]);
+  if (cells_dims[1] == 3) {
+    H5LTread_dataset(file_id, "cells", H5T_NATIVE_ULLONG, cells_data.data());
+    H5LTread_dataset(file_id, "cell_particles", H5T_NATIVE_ULLONG,
+                     cell_particles.data());
+  }
+  H5Fclose(file_id);
+  if (cells_dims[1] != 3)
+    throw std::runtime_error("HDF5 cells have incorrect number of fields");
+
+  int mpi_size = 1;
+#ifdef USE_MPI
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+#endif
+
+  // A partition of another mesh or number of ranks is not restored
+  mpm::Index offset = 0;
+  for (hsize_t i = 0; i < cells_dims[0]; ++i) {
+    offset += cells_data[i * 3 + 2];
+    if (offset > cell_particles.size())
+      throw std::runtime_error("HDF5 cells do not match the cell particles");
+    if (map_cells_.find(cells_data[i * 3]) == map_cells_.end() ||
+        cells_data[i * 3 + 1] >= static_cast<mpm::Index>(mpi_size))
+      return false;
+  }
+
+  // Stored cells, their ranks and the offsets of their particles
+  std::vector<std::shared_ptr<mpm::Cell<Tdim>>> cells(cells_dims[0]);
+  std::vector<mpm::Index> offsets(cells_dims[0] + 1, 0);
+  for (hsize_t i = 0; i < cells_dims[0]; ++i) {
+    cells[i] = map_cells_[cells_data[i * 3]];
+    cells[i]->rank(cells_data[i * 3 + 1]);
+    offsets[i + 1] = offsets[i] + cells_data[i * 3 + 2];
+  }
+
+  // Detach particles from their cells
+  const long nparticles = particles_.size();
+#pragma omp parallel for schedule(runtime)
+  for (long i = 0; i < nparticles; ++i) particles_[i]->remove_cell();
+
+  // Assign particles to their stored cells in the stored order, only the
+  // local coordinates are computed. A particle outside its stored cell is
+  // located by a search starting from the stored cell.
+#pragma omp parallel for schedule(runtime)
+  for (long i = 0; i < static_cast<long>(cells.size()); ++i) {
+    VectorDim xi;
+    for (mpm::Index j = offsets[i]; j < offsets[i + 1]; ++j) {
+      auto pitr = map_particles_.find(cell_particles[j]);
+      if (pitr == map_particles_.end()) continue;
+      const auto& particle = pitr->second;
+      if (!cells[i]->is_point_in_cell(particle->coordinates(), &xi) ||
+          !particle->assign_cell_xi(cells[i], xi)) {
+        particle->remove_cell();
+        particle->assign_cell_id(cells[i]->id());
+      }
+    }
+  }
+
+  // Particles assigned to their stored cells
+  std::vector<char> located(nparticles, 0);
+#pragma omp parallel for schedule(runtime)
+  for (long i = 0; i < nparticles; ++i) located[i] = particles_[i]->cell_ptr();
+
+  // Particles outside their stored cells or missing from the stored cells
+  for (long i = 0; i < nparticles; ++i)
+    if (!located[i] && !this->locate_particle_cells(particles_[i]))
+      unlocatable_particles->emplace_back(particles_[i]);
+
+  step_plan_valid_ = false;
+  return true;
+}
+
 //! Write particles to HDF5
 template <unsigned Tdim>
 std::vector<mpm::HDF5Particle> mpm::Mesh<Tdim>::particles_hdf5() const {
@@ -1617,6 +2358,7 @@ bool mpm::Mesh<Tdim>::create_particle_sets(
                        sitr->first, particles))
                    .second;
     }
+    step_plan_valid_ = false;
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
   }
@@ -1683,6 +2425,7 @@ bool mpm::Mesh<Tdim>::create_cell_sets(
                        sitr->first, cells))
                    .second;
     }
+    step_plan_valid_ = false;
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
   }
@@ -1767,8 +2510,12 @@ bool mpm::Mesh<Tdim>::generate_particles(const std::shared_ptr<mpm::IO>& io,
         for (unsigned i = 0; i < Tdim; ++i)
           inject.velocity[i] = generator["velocity"].at(i);
       }
+      // Volumetric flow rate
+      if (generator.contains("flow_rate"))
+        inject.flow_rate = generator["flow_rate"].template get<double>();
       // Add to particle injections
       particle_injections_.emplace_back(inject);
+      step_plan_valid_ = false;
     }
 
     else
@@ -1782,70 +2529,187 @@ bool mpm::Mesh<Tdim>::generate_particles(const std::shared_ptr<mpm::IO>& io,
   return status;
 }
 
-//! Generate particles
+//! Check if any particle injection is active at the current time
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::injection_active(double current_time) const {
+  for (const auto& injection : particle_injections_)
+    if (injection.start_time <= current_time &&
+        injection.end_time > current_time)
+      return true;
+  return false;
+}
+
+//! Inject particles
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::inject_particles(double current_time) {
+  mpm::ScopedTimer timer("inject");
+  // Skip when no injection window contains the current time
+  if (!this->injection_active(current_time)) return;
+
   int mpi_rank = 0;
+  int mpi_size = 1;
 #ifdef USE_MPI
   MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+#endif
+
+  // Injected particle ids start above the largest particle id of all ranks
+  if (!injection_ids_initialised_) {
+    mpm::Index max_id = 0;
+    for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
+      max_id = std::max(max_id, (*pitr)->id() + 1);
+#ifdef USE_MPI
+    MPI_Allreduce(MPI_IN_PLACE, &max_id, 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX,
+                  MPI_COMM_WORLD);
 #endif
+    injection_id_offset_ = max_id;
+    injection_counter_ = 0;
+    injection_ids_initialised_ = true;
+  }
+
+  // Injection cells of this rank
+  this->update_step_plan();
+
   // Container of new injected particles
   std::vector<std::shared_ptr<ParticleBase<Tdim>>> injected_particles;
-  // Iterate over all injection cells
-  for (auto injection : particle_injections_) {
-    unsigned pid = this->nparticles();
-    bool checks = false;
+  // Iterate over all injections
+  for (unsigned i = 0; i < particle_injections_.size(); ++i) {
+    auto& injection = particle_injections_[i];
+    // Check if duration is within the current time
+    if (injection.start_time > current_time ||
+        injection.end_time <= current_time)
+      continue;
+
+    // Empty injection cells
+    std::vector<std::shared_ptr<Cell<Tdim>>> cells;
+    for (const auto& cell : injection_cells_[i])
+      if (cell->nparticles() == 0) cells.emplace_back(cell);
+
+    // Limit cells to the volume of the flow rate over the elapsed time
+    if (injection.flow_rate > 0.) {
+      const double remaining_volume =
+          injection.flow_rate * (current_time - injection.start_time) -
+          injection.injected_volume;
+      // Volume of empty cells on lower ranks
+      double cells_volume = 0.;
+      for (const auto& cell : cells) cells_volume += cell->volume();
+      double preceding_volume = 0.;
+#ifdef USE_MPI
+      MPI_Exscan(&cells_volume, &preceding_volume, 1, MPI_DOUBLE, MPI_SUM,
+                 MPI_COMM_WORLD);
+      if (mpi_rank == 0) preceding_volume = 0.;
+#endif
+      const double rank_volume = remaining_volume - preceding_volume;
+      double volume = 0.;
+      unsigned ncells = 0;
+      while (ncells < cells.size() &&
+             volume + cells[ncells]->volume() <= rank_volume)
+        volume += cells[ncells++]->volume();
+      cells.resize(ncells);
+    }
+
+    // Shape functions at local points of each cell and particle offsets
+    std::vector<const Eigen::MatrixXd*> shapefns(cells.size());
+    std::vector<mpm::Index> offsets(cells.size() + 1, 0);
+    for (unsigned c = 0; c < cells.size(); ++c) {
+      const auto element = cells[c]->element_ptr();
+      const auto key = std::make_pair(element.get(), injection.nparticles_dir);
+      auto sitr = injection_shapefns_.find(key);
+      if (sitr == injection_shapefns_.end()) {
+        const Eigen::MatrixXd xi =
+            element->quadrature(injection.nparticles_dir)->quadratures();
+        const Eigen::Matrix<double, Tdim, 1> zeros =
+            Eigen::Matrix<double, Tdim, 1>::Zero();
+        Eigen::MatrixXd shapefn(element->nfunctions(), xi.cols());
+        for (unsigned j = 0; j < xi.cols(); ++j)
+          shapefn.col(j) = element->shapefn(xi.col(j), zeros, zeros);
+        sitr = injection_shapefns_.emplace(key, shapefn).first;
+      }
+      shapefns[c] = &(sitr->second);
+      offsets[c + 1] = offsets[c] + sitr->second.cols();
+    }
+
     // Get material
     std::vector<std::shared_ptr<mpm::Material<Tdim>>> materials;
     for (auto m_id : injection.material_ids)
       materials.emplace_back(materials_.at(m_id));
+    // Particle velocity
+    const Eigen::Matrix<double, Tdim, 1> pvelocity(injection.velocity.data());
 
-    // Check if duration is within the current time
-    if (injection.start_time <= current_time &&
-        injection.end_time > current_time) {
-      // If set id is -1, use all cells
-      auto cset = (injection.cell_set_id == -1)
-                      ? this->cells_
-                      : cell_sets_.at(injection.cell_set_id);
-      // Iterate over each cell to generate points
-      for (auto citr = cset.cbegin(); citr != cset.cend(); ++citr) {
-        if ((*citr)->rank() == mpi_rank && (*citr)->nparticles() == 0) {
-          // Assign quadratures based on number of particles
-          (*citr)->assign_quadrature(injection.nparticles_dir);
-
-          // Genereate particles at the Gauss points
-          const auto cpoints = (*citr)->generate_points();
-          // Iterate over each coordinate to generate material points
-          for (const auto& coordinates : cpoints) {
-            // Create particle
-            auto particle =
-                Factory<mpm::ParticleBase<Tdim>, mpm::Index,
-                        const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                    ->create(injection.particle_type,
-                             static_cast<mpm::Index>(pid), coordinates);
-
-            // particle velocity
-            Eigen::Matrix<double, Tdim, 1> pvelocity(injection.velocity.data());
-            particle->assign_velocity(pvelocity);
-
-            // Add particle to mesh
-            unsigned status = this->add_particle(particle, checks);
-            if (status) {
-              map_particles_[pid]->assign_cell(*citr);
-              for (unsigned phase = 0; phase < materials.size(); phase++)
-                map_particles_[pid]->assign_material(materials[phase], phase);
-              ++pid;
-              injected_particles.emplace_back(particle);
-            }
-          }
+    // Create particles of each cell in parallel
+    const mpm::Index nnew = offsets.back();
+    const mpm::Index first = injected_particles.size();
+    injected_particles.resize(first + nnew);
+#pragma omp parallel for schedule(runtime)
+    for (unsigned c = 0; c < cells.size(); ++c) {
+      // Coordinates of points in the cell
+      const Eigen::MatrixXd points =
+          cells[c]->nodal_coordinates().transpose() * (*shapefns[c]);
+      for (unsigned j = 0; j < points.cols(); ++j) {
+        const mpm::Index index = offsets[c] + j;
+        // Rank-partitioned particle id
+        const mpm::Index pid = injected_particle_id(
+            injection_id_offset_, injection_counter_, index, mpi_rank,
+            mpi_size);
+        const Eigen::Matrix<double, Tdim, 1> coordinates = points.col(j);
+        // Check if the point is within the cell
+        const Eigen::Matrix<double, Tdim, 1> xi =
+            cells[c]->transform_real_to_unit_cell(coordinates);
+        bool inside = true;
+        for (unsigned k = 0; k < Tdim; ++k)
+          if (xi(k) < -1. || xi(k) > 1. || std::isnan(xi(k))) inside = false;
+        if (!inside) {
+          console_->warn("Cannot inject point {} outside cell {}", j,
+                         cells[c]->id());
+          continue;
         }
+        auto particle =
+            Factory<mpm::ParticleBase<Tdim>, mpm::Index,
+                    const Eigen::Matrix<double, Tdim, 1>&>::instance()
+                ->create(injection.particle_type,
+                         mpm::PoolAllocator<mpm::ParticleBase<Tdim>>(
+                             particle_pool_),
+                         static_cast<mpm::Index>(pid), coordinates);
+        particle->assign_velocity(pvelocity);
+        particle->assign_cell_xi(cells[c], xi);
+        for (unsigned phase = 0; phase < materials.size(); phase++)
+          particle->assign_material(materials[phase], phase);
+        injected_particles[first + index] = particle;
       }
     }
-    for (auto particle : injected_particles) {
-      particle->compute_volume();
-      particle->compute_mass();
+    injection_counter_ += nnew;
+
+    // Add particles to mesh, points outside their cell are not injected
+    injected_particles.erase(
+        std::remove(injected_particles.begin() + first,
+                    injected_particles.end(), nullptr),
+        injected_particles.end());
+    for (mpm::Index p = first; p < injected_particles.size(); ++p)
+      this->add_particle(injected_particles[p], false);
+
+    // Volume of the particles created
+    if (injection.flow_rate > 0.) {
+      const mpm::Index last = injected_particles.size();
+      double volume = 0.;
+#pragma omp parallel for schedule(runtime) reduction(+ : volume)
+      for (mpm::Index p = first; p < last; ++p) {
+        injected_particles[p]->compute_volume();
+        volume += injected_particles[p]->volume();
+      }
+#ifdef USE_MPI
+      MPI_Allreduce(MPI_IN_PLACE, &volume, 1, MPI_DOUBLE, MPI_SUM,
+                    MPI_COMM_WORLD);
+#endif
+      injection.injected_volume += volume;
     }
   }
+
+#pragma omp parallel for schedule(runtime)
+  for (auto pitr = injected_particles.cbegin();
+       pitr != injected_particles.cend(); ++pitr) {
+    (*pitr)->compute_volume();
+    (*pitr)->compute_mass();
+  }
 }
 
 // Read particles file
@@ -1908,12 +2772,15 @@ bool mpm::Mesh<Tdim>::assign_nodal_concentrated_forces(
       // Force
       double force = std::get<2>(nodal_force);
 
-      if (map_nodes_.find(pid) != map_nodes_.end())
+      if (map_nodes_.find(pid) != map_nodes_.end()) {
         status = map_nodes_[pid]->assign_concentrated_force(phase, dir, force,
                                                             nullptr);
+        if (status) concentrated_force_nodes_.add(map_nodes_[pid]);
+      }
 
       if (!status) throw std::runtime_error("Force is invalid for node");
     }
+    step_plan_valid_ = false;
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
     status = false;
@@ -1921,6 +2788,22 @@ bool mpm::Mesh<Tdim>::assign_nodal_concentrated_forces(
   return status;
 }
 
+//! Clear particle tractions and nodal concentrated forces
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::clear_loads() {
+  // TODO: Remove phase
+  const unsigned phase = 0;
+  mpm::parallel_for(concentrated_force_nodes_.cbegin(),
+                    concentrated_force_nodes_.cend(), [phase](auto nitr) {
+                      for (unsigned i = 0; i < Tdim; ++i)
+                        (*nitr)->assign_concentrated_force(phase, i, 0.,
+                                                           nullptr);
+                    });
+  concentrated_force_nodes_.clear();
+  particle_tractions_.clear();
+  step_plan_valid_ = false;
+}
+
 // Create the nodal properties' map
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::create_nodal_properties() {
@@ -2,6 +2,8 @@
 #define MPM_MUTEX_H_
 
 #include <atomic>
+#include <chrono>
+#include <thread>
 
 namespace mpm {
 //! Hybrid SpinMutex class
@@ -192,6 +192,21 @@ class Node : public NodeBase<Tdim> {
   bool compute_acceleration_velocity_cundall(
       unsigned phase, double dt, double damping_factor) noexcept override;
 
+  //! Compute acceleration and velocity with viscous damping and mass scaling
+  //! \details Acceleration is the unbalanced force over the scaled mass less
+  //! the damping coefficient times the velocity
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] dt Timestep in analysis
+  //! \param[in] damping_coefficient Mass proportional damping coefficient
+  //! \param[in] mass_scaling Scaling factor of the inertial mass
+  bool compute_acceleration_velocity_viscous(
+      unsigned phase, double dt, double damping_coefficient,
+      double mass_scaling) noexcept override;
+
+  //! Return unbalanced force in directions free of velocity constraints
+  //! \param[in] phase Index corresponding to the phase
+  VectorDim unbalanced_force(unsigned phase) const override;
+
   //! Assign velocity constraint
   //! Directions can take values between 0 and Dim * Nphases
   //! \param[in] dir Direction of velocity constraint
@@ -222,6 +237,14 @@ class Node : public NodeBase<Tdim> {
   //! \param[in] dt Time-step
   void apply_friction_constraints(double dt) override;
 
+  //! Clear velocity and friction constraints and rotation matrix
+  void clear_constraints() noexcept override {
+    velocity_constraints_.clear();
+    friction_ = false;
+    rotation_matrix_.setIdentity();
+    generic_boundary_constraints_ = false;
+  }
+
   //! Assign rotation matrix
   //! \param[in] rotation_matrix Rotation matrix of the node
   void assign_rotation_matrix(
@@ -292,6 +292,55 @@ bool mpm::Node<Tdim, Tdof, Tnphases>::compute_acceleration_velocity_cundall(
   return status;
 }
 
+//! Compute acceleration and velocity with viscous damping and mass scaling
+template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
+bool mpm::Node<Tdim, Tdof, Tnphases>::compute_acceleration_velocity_viscous(
+    unsigned phase, double dt, double damping_coefficient,
+    double mass_scaling) noexcept {
+  bool status = false;
+  const double tolerance = 1.0E-15;
+  if (mass_(phase) > tolerance) {
+    // acceleration = (unbalaced force / scaled mass) - damping * velocity
+    this->acceleration_.col(phase) =
+        (this->external_force_.col(phase) + this->internal_force_.col(phase)) /
+            (mass_scaling * this->mass_(phase)) -
+        damping_coefficient * this->velocity_.col(phase);
+
+    // Apply friction constraints
+    this->apply_friction_constraints(dt);
+
+    // Velocity += acceleration * dt
+    this->velocity_.col(phase) += this->acceleration_.col(phase) * dt;
+    // Apply velocity constraints, which also sets acceleration to 0,
+    // when velocity is set.
+    this->apply_velocity_constraints();
+
+    // Set a threshold
+    for (unsigned i = 0; i < Tdim; ++i)
+      if (std::abs(velocity_.col(phase)(i)) < tolerance)
+        velocity_.col(phase)(i) = 0.;
+    for (unsigned i = 0; i < Tdim; ++i)
+      if (std::abs(acceleration_.col(phase)(i)) < tolerance)
+        acceleration_.col(phase)(i) = 0.;
+    status = true;
+  }
+  return status;
+}
+
+//! Return unbalanced force in directions free of velocity constraints
+template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
+Eigen::Matrix<double, Tdim, 1>
+    mpm::Node<Tdim, Tdof, Tnphases>::unbalanced_force(unsigned phase) const {
+  Eigen::Matrix<double, Tdim, 1> force =
+      this->external_force_.col(phase) + this->internal_force_.col(phase);
+  // Constrained directions carry the reaction force
+  if (generic_boundary_constraints_) force = rotation_matrix_.inverse() * force;
+  for (const auto& constraint : this->velocity_constraints_)
+    if (constraint.first / Tdim == phase) force(constraint.first % Tdim) = 0.;
+  if (generic_boundary_constraints_) force = rotation_matrix_ * force;
+  return force;
+}
+
 //! Assign velocity constraint
 //! Constrain directions can take values between 0 and Dim * Nphases
 template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
@@ -184,6 +184,19 @@ class NodeBase {
   virtual bool compute_acceleration_velocity_cundall(
       unsigned phase, double dt, double damping_factor) noexcept = 0;
 
+  //! Compute acceleration and velocity with viscous damping and mass scaling
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] dt Timestep in analysis
+  //! \param[in] damping_coefficient Mass proportional damping coefficient
+  //! \param[in] mass_scaling Scaling factor of the inertial mass
+  virtual bool compute_acceleration_velocity_viscous(
+      unsigned phase, double dt, double damping_coefficient,
+      double mass_scaling) noexcept = 0;
+
+  //! Return unbalanced force in directions free of velocity constraints
+  //! \param[in] phase Index corresponding to the phase
+  virtual VectorDim unbalanced_force(unsigned phase) const = 0;
+
   //! Assign velocity constraint
   //! Directions can take values between 0 and Dim * Nphases
   //! \param[in] dir Direction of velocity constraint
@@ -214,6 +227,9 @@ class NodeBase {
   //! \param[in] dt Time-step
   virtual void apply_friction_constraints(double dt) = 0;
 
+  //! Clear velocity and friction constraints and rotation matrix
+  virtual void clear_constraints() noexcept = 0;
+
   //! Assign rotation matrix
   //! \param[in] rotation_matrix Rotation matrix of the node
   virtual void assign_rotation_matrix(
@@ -0,0 +1,59 @@
+#ifndef MPM_PARALLEL_FOR_H_
+#define MPM_PARALLEL_FOR_H_
+
+#include <algorithm>
+#include <iterator>
+
+// OpenMP
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace mpm {
+
+//! Apply an operation to each iterator of a random access range in parallel
+//! \details Outside of a parallel region the range is shared by a parallel
+//! loop. Inside a parallel region, e.g. in a task of a step graph, the range
+//! is split into tasks of the enclosing team instead of opening a nested
+//! parallel region, and the call returns once the tasks are complete. Idle
+//! threads of the team pick up these tasks along with other branches of the
+//! graph.
+//! \param[in] begin Iterator to the first item
+//! \param[in] end Iterator past the last item
+//! \param[in] oper Operation on an iterator
+//! \param[in] static_schedule Share the range of a parallel loop by a static
+//! schedule, e.g., as the items were first touched, instead of the runtime
+//! schedule
+template <typename Titr, typename Toper>
+void parallel_for(Titr begin, Titr end, Toper oper,
+                  bool static_schedule = false) {
+#ifdef _OPENMP
+  if (omp_in_parallel()) {
+    const long nitems = std::distance(begin, end);
+    // Few chunks per thread to balance the load
+    const long nchunks =
+        std::min(nitems, static_cast<long>(4 * omp_get_num_threads()));
+#pragma omp taskgroup
+    {
+      for (long chunk = 0; chunk < nchunks; ++chunk) {
+        const Titr first = begin + (nitems * chunk) / nchunks;
+        const Titr last = begin + (nitems * (chunk + 1)) / nchunks;
+#pragma omp task firstprivate(first, last) shared(oper)
+        for (auto itr = first; itr != last; ++itr) oper(itr);
+      }
+    }  // Wait for the tasks of the range
+    return;
+  }
+#endif
+  if (static_schedule) {
+#pragma omp parallel for schedule(static)
+    for (auto itr = begin; itr != end; ++itr) oper(itr);
+    return;
+  }
+#pragma omp parallel for schedule(runtime)
+  for (auto itr = begin; itr != end; ++itr) oper(itr);
+}
+
+}  // namespace mpm
+
+#endif  // MPM_PARALLEL_FOR_H_
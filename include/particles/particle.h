@@ -1,9 +1,11 @@
 #ifndef MPM_PARTICLE_H_
 #define MPM_PARTICLE_H_
 
+#include <algorithm>
 #include <array>
 #include <limits>
 #include <memory>
+#include <new>
 #include <string>
 #include <vector>
 
@@ -114,6 +116,12 @@ class Particle : public ParticleBase<Tdim> {
   //! Compute shape functions of a particle, based on local coordinates
   void compute_shapefn() noexcept override;
 
+  //! Assign a slot of a shape function cache
+  //! \param[in] cache Shape function cache of the mesh
+  //! \param[in] index Index of the particle slot in the cache
+  void assign_shapefn_cache(const std::shared_ptr<mpm::ShapefnCache>& cache,
+                            mpm::Index index) noexcept override;
+
   //! Assign volume
   //! \param[in] volume Volume of particle
   bool assign_volume(double volume) override;
@@ -163,6 +171,13 @@ class Particle : public ParticleBase<Tdim> {
   bool assign_material(const std::shared_ptr<Material<Tdim>>& material,
                        unsigned phase = mpm::ParticlePhase::Solid) override;
 
+  //! Replace material keeping the values of state variables with the same
+  //! name, other state variables are initialised by the material
+  //! \param[in] material Pointer to a material
+  //! \param[in] phase Index to indicate phase
+  bool replace_material(const std::shared_ptr<Material<Tdim>>& material,
+                        unsigned phase = mpm::ParticlePhase::Solid) override;
+
   //! Compute strain
   //! \param[in] dt Analysis time step
   void compute_strain(double dt) noexcept override;
@@ -175,6 +190,9 @@ class Particle : public ParticleBase<Tdim> {
     return strain_rate_;
   };
 
+  //! Return strain increment of the particle
+  Eigen::Matrix<double, 6, 1> dstrain() const override { return dstrain_; }
+
   //! Return dvolumetric strain of centroid
   //! \retval dvolumetric strain at centroid
   double dvolumetric_strain() const override { return dvolumetric_strain_; }
@@ -194,6 +212,13 @@ class Particle : public ParticleBase<Tdim> {
   //! Compute stress
   void compute_stress() noexcept override;
 
+  //! Assign stress updated by the material
+  //! \param[in] stress Updated stress
+  void update_stress(const Eigen::Matrix<double, 6, 1>& stress) noexcept
+      override {
+    this->stress_ = stress;
+  }
+
   //! Return stress of the particle
   Eigen::Matrix<double, 6, 1> stress() const override { return stress_; }
 
@@ -204,6 +229,13 @@ class Particle : public ParticleBase<Tdim> {
   //! Map internal force
   inline void map_internal_force() noexcept override;
 
+  //! Map internal force of a trial stress from the nodal velocity
+  //! \details The strain increment of the nodal velocity over the time step
+  //! updates a copy of the stress and state variables, which are mapped as
+  //! internal force without changing the particle
+  //! \param[in] dt Analysis time step
+  void map_trial_internal_force(double dt) noexcept override;
+
   //! Assign velocity to the particle
   //! \param[in] velocity A vector of particle velocity
   //! \retval status Assignment status
@@ -215,6 +247,15 @@ class Particle : public ParticleBase<Tdim> {
   //! Return displacement of the particle
   VectorDim displacement() const override { return displacement_; }
 
+  //! Return acceleration of the particle
+  VectorDim acceleration() const override { return acceleration_; }
+
+  //! Map mass weighted acceleration to nodes
+  void map_acceleration_to_nodes() noexcept override;
+
+  //! Interpolate the nodal acceleration to the particle
+  void interpolate_acceleration() noexcept override;
+
   //! Assign traction to the particle
   //! \param[in] direction Index corresponding to the direction of traction
   //! \param[in] traction Particle traction in specified direction
@@ -234,6 +275,14 @@ class Particle : public ParticleBase<Tdim> {
   void compute_updated_position(double dt,
                                 bool velocity_update = false) noexcept override;
 
+  //! Compute updated position with Newmark integration
+  //! \details Nodal velocity is the displacement increment over the time step
+  //! and nodal acceleration is the acceleration at the end of the step
+  //! \param[in] dt Analysis time step
+  //! \param[in] gamma Newmark gamma parameter
+  void compute_updated_position_newmark(double dt,
+                                        double gamma) noexcept override;
+
   //! Return a state variable
   //! \param[in] var State variable
   //! \param[in] phase Index to indicate phase
@@ -288,15 +337,22 @@ class Particle : public ParticleBase<Tdim> {
   void append_material_id_to_nodes() const override;
 
   //! Return the number of neighbour particles
-  unsigned nneighbours() const override { return neighbours_.size(); };
+  unsigned nneighbours() const override;
+
+  //! Assign the cell list of neighbour particles
+  //! \details Neighbours are read from the cell list of the particle cell
+  //! instead of being copied to each particle
+  //! \param[in] cell_list Cell list with the particles of the particle cell
+  //! and its neighbour cells
+  void assign_neighbours(
+      const std::shared_ptr<const mpm::CellList>& cell_list) override;
 
-  //! Assign neighbour particles
-  //! \param[in] neighbours set of id of the neighbouring particles
-  //! \retval insertion_status Return the successful addition of a node
-  void assign_neighbours(const std::vector<mpm::Index>& neighbours) override;
+  //! Return ranges of particle ids of the particle cell and its neighbour
+  //! cells, including the particle itself
+  std::vector<mpm::CellList::Range> neighbour_ranges() const override;
 
   //! Return neighbour ids
-  std::vector<mpm::Index> neighbours() const override { return neighbours_; }
+  std::vector<mpm::Index> neighbours() const override;
 
   //! Type of particle
   std::string type() const override { return (Tdim == 2) ? "P2D" : "P3D"; }
@@ -327,7 +383,15 @@ class Particle : public ParticleBase<Tdim> {
   //! \param[in] phase Index to indicate phase
   //! \retval strain rate at particle inside a cell
   inline Eigen::Matrix<double, 6, 1> compute_strain_rate(
-      const Eigen::MatrixXd& dn_dx, unsigned phase) noexcept;
+      const Eigen::Ref<const Eigen::MatrixXd>& dn_dx, unsigned phase) noexcept;
+
+  //! Map internal force of a stress
+  //! \param[in] stress Stress of the particle
+  inline void map_internal_force(
+      const Eigen::Matrix<double, 6, 1>& stress) noexcept;
+
+  //! Assign nodal pointers of the cell
+  void assign_cell_nodes();
 
   //! Compute pack size
   //! \retval pack size of serialized object
@@ -354,8 +418,8 @@ class Particle : public ParticleBase<Tdim> {
   using ParticleBase<Tdim>::material_id_;
   //! State variables
   using ParticleBase<Tdim>::state_variables_;
-  //! Neighbour particles
-  using ParticleBase<Tdim>::neighbours_;
+  //! Cell list of neighbour particles
+  using ParticleBase<Tdim>::cell_list_;
   //! Volumetric mass density (mass / volume)
   double mass_density_{0.};
   //! Mass
@@ -382,27 +446,33 @@ class Particle : public ParticleBase<Tdim> {
   Eigen::Matrix<double, Tdim, 1> velocity_;
   //! Displacement
   Eigen::Matrix<double, Tdim, 1> displacement_;
+  //! Acceleration
+  Eigen::Matrix<double, Tdim, 1> acceleration_;
   //! Particle velocity constraints
   std::map<unsigned, double> particle_velocity_constraints_;
   //! Set traction
   bool set_traction_{false};
   //! Surface Traction (given as a stress; force/area)
   Eigen::Matrix<double, Tdim, 1> traction_;
-  //! Shape functions
-  Eigen::VectorXd shapefn_;
-  //! dN/dX
-  Eigen::MatrixXd dn_dx_;
-  //! dN/dX at cell centroid
-  Eigen::MatrixXd dn_dx_centroid_;
+  //! State variables updated by the trial stress, reused in each iteration
+  mpm::dense_map trial_state_variables_;
+  //! Shape functions, a view of the cache slot or of the local storage
+  Eigen::Map<Eigen::Matrix<mpm::StorageReal, Eigen::Dynamic, 1>> shapefn_{
+      nullptr, 0};
+  //! dN/dX, a view of the cache slot or of the local storage
+  Eigen::Map<Eigen::Matrix<mpm::StorageReal, Eigen::Dynamic, Eigen::Dynamic>>
+      dn_dx_{nullptr, 0, Tdim};
+  //! Shape function cache of the mesh
+  std::shared_ptr<mpm::ShapefnCache> shapefn_cache_{nullptr};
+  //! Index of the particle slot in the shape function cache
+  mpm::Index shapefn_index_{0};
+  //! Local shape functions, used without a shape function cache
+  Eigen::Matrix<mpm::StorageReal, Eigen::Dynamic, 1> shapefn_storage_;
+  //! Local dN/dX, used without a shape function cache
+  Eigen::Matrix<mpm::StorageReal, Eigen::Dynamic, Eigen::Dynamic>
+      dn_dx_storage_;
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
-  //! Map of scalar properties
-  tsl::robin_map<std::string, std::function<double()>> scalar_properties_;
-  //! Map of vector properties
-  tsl::robin_map<std::string, std::function<VectorDim()>> vector_properties_;
-  //! Map of tensor properties
-  tsl::robin_map<std::string, std::function<Eigen::VectorXd()>>
-      tensor_properties_;
   //! Pack size
   unsigned pack_size_{0};
 
@@ -229,6 +229,7 @@ mpm::HDF5Particle mpm::Particle<Tdim>::hdf5() const {
 // Initialise particle properties
 template <unsigned Tdim>
 void mpm::Particle<Tdim>::initialise() {
+  acceleration_.setZero();
   displacement_.setZero();
   dstrain_.setZero();
   mass_ = 0.;
@@ -242,15 +243,6 @@ void mpm::Particle<Tdim>::initialise() {
   velocity_.setZero();
   volume_ = std::numeric_limits<double>::max();
   volumetric_strain_centroid_ = 0.;
-
-  // Initialize scalar, vector, and tensor data properties
-  this->scalar_properties_["mass"] = [&]() { return mass(); };
-  this->scalar_properties_["volume"] = [&]() { return volume(); };
-  this->scalar_properties_["mass_density"] = [&]() { return mass_density(); };
-  this->vector_properties_["displacements"] = [&]() { return displacement(); };
-  this->vector_properties_["velocities"] = [&]() { return velocity(); };
-  this->tensor_properties_["stresses"] = [&]() { return stress(); };
-  this->tensor_properties_["strains"] = [&]() { return strain(); };
 }
 
 //! Initialise particle material container
@@ -298,11 +290,8 @@ bool mpm::Particle<Tdim>::assign_cell(
 
       cell_ = cellptr;
       cell_id_ = cellptr->id();
-      // dn_dx centroid
-      dn_dx_centroid_ = cell_->dn_dx_centroid();
-      // Copy nodal pointer to cell
-      nodes_.clear();
-      nodes_ = cell_->nodes();
+      // Nodal pointers of the cell
+      this->assign_cell_nodes();
 
       // Compute reference location of particle
       bool xi_status = this->compute_reference_location();
@@ -332,11 +321,8 @@ bool mpm::Particle<Tdim>::assign_cell_xi(
 
       cell_ = cellptr;
       cell_id_ = cellptr->id();
-      // dn_dx centroid
-      dn_dx_centroid_ = cell_->dn_dx_centroid();
-      // Copy nodal pointer to cell
-      nodes_.clear();
-      nodes_ = cell_->nodes();
+      // Nodal pointers of the cell
+      this->assign_cell_nodes();
 
       // Assign the reference location of particle
       bool xi_nan = false;
@@ -361,6 +347,14 @@ bool mpm::Particle<Tdim>::assign_cell_xi(
   return status;
 }
 
+// Assign nodal pointers of the cell
+template <unsigned Tdim>
+void mpm::Particle<Tdim>::assign_cell_nodes() {
+  const auto& nodes = cell_->nodes();
+  nodes_.resize(nodes.size());
+  for (unsigned i = 0; i < nodes.size(); ++i) nodes_[i] = nodes[i].get();
+}
+
 // Assign a cell id to particle
 template <unsigned Tdim>
 bool mpm::Particle<Tdim>::assign_cell_id(mpm::Index id) {
@@ -388,6 +382,10 @@ void mpm::Particle<Tdim>::remove_cell() {
   cell_id_ = std::numeric_limits<Index>::max();
   // Clear all the nodes
   nodes_.clear();
+  // Detach from the shape function cache, whose slot may be reassigned
+  shapefn_cache_ = nullptr;
+  new (&shapefn_) decltype(shapefn_)(nullptr, 0);
+  new (&dn_dx_) decltype(dn_dx_)(nullptr, 0, Tdim);
 }
 
 // Assign a material to particle
@@ -412,6 +410,20 @@ bool mpm::Particle<Tdim>::assign_material(
   return status;
 }
 
+//! Replace material keeping state variables with the same name
+template <unsigned Tdim>
+bool mpm::Particle<Tdim>::replace_material(
+    const std::shared_ptr<Material<Tdim>>& material, unsigned phase) {
+  const auto state_vars = state_variables_.at(phase);
+  const bool status = this->assign_material(material, phase);
+  if (status)
+    for (const auto& state_var : state_vars)
+      if (state_variables_[phase].find(state_var.first) !=
+          state_variables_[phase].end())
+        state_variables_[phase][state_var.first] = state_var.second;
+  return status;
+}
+
 // Compute reference location cell to particle
 template <unsigned Tdim>
 bool mpm::Particle<Tdim>::compute_reference_location() noexcept {
@@ -439,12 +451,52 @@ void mpm::Particle<Tdim>::compute_shapefn() noexcept {
   // Zero matrix
   Eigen::Matrix<double, Tdim, 1> zero = Eigen::Matrix<double, Tdim, 1>::Zero();
 
+  // Storage of shape functions, in the cache slot if one is assigned
+  const unsigned nfunctions = element->nfunctions();
+  mpm::StorageReal* shapefn = nullptr;
+  mpm::StorageReal* dn_dx = nullptr;
+  if (shapefn_cache_ != nullptr &&
+      shapefn_index_ < shapefn_cache_->nparticles() &&
+      nfunctions <= shapefn_cache_->nfunctions()) {
+    shapefn = shapefn_cache_->shapefn(shapefn_index_);
+    dn_dx = shapefn_cache_->dn_dx(shapefn_index_);
+  } else {
+    shapefn_storage_.resize(nfunctions);
+    dn_dx_storage_.resize(nfunctions, Tdim);
+    shapefn = shapefn_storage_.data();
+    dn_dx = dn_dx_storage_.data();
+  }
+  new (&shapefn_) decltype(shapefn_)(shapefn, nfunctions);
+  new (&dn_dx_) decltype(dn_dx_)(dn_dx, nfunctions, Tdim);
+
   // Compute shape function of the particle
-  shapefn_ = element->shapefn(this->xi_, this->natural_size_, zero);
+  shapefn_ = element->shapefn(this->xi_, this->natural_size_, zero)
+                 .template cast<mpm::StorageReal>();
 
   // Compute dN/dx
-  dn_dx_ = element->dn_dx(this->xi_, cell_->nodal_coordinates(),
-                          this->natural_size_, zero);
+  dn_dx_ = element
+               ->dn_dx(this->xi_, cell_->nodal_coordinates(),
+                       this->natural_size_, zero)
+               .template cast<mpm::StorageReal>();
+}
+
+// Assign a slot of a shape function cache
+template <unsigned Tdim>
+void mpm::Particle<Tdim>::assign_shapefn_cache(
+    const std::shared_ptr<mpm::ShapefnCache>& cache,
+    mpm::Index index) noexcept {
+  // Avoid reference count updates when the cache is unchanged
+  if (shapefn_cache_ != cache) shapefn_cache_ = cache;
+  shapefn_index_ = index;
+  // Views refer to the slot, the storage of the cache may have moved
+  if (cache != nullptr && index < cache->nparticles() &&
+      shapefn_.size() <= cache->nfunctions()) {
+    new (&shapefn_) decltype(shapefn_)(cache->shapefn(index), shapefn_.size());
+    new (&dn_dx_) decltype(dn_dx_)(cache->dn_dx(index), shapefn_.size(), Tdim);
+  } else {
+    new (&shapefn_) decltype(shapefn_)(nullptr, 0);
+    new (&dn_dx_) decltype(dn_dx_)(nullptr, 0, Tdim);
+  }
 }
 
 // Assign volume to the particle
@@ -580,7 +632,7 @@ void mpm::Particle<
 // Compute strain rate of the particle
 template <>
 inline Eigen::Matrix<double, 6, 1> mpm::Particle<1>::compute_strain_rate(
-    const Eigen::MatrixXd& dn_dx, unsigned phase) noexcept {
+    const Eigen::Ref<const Eigen::MatrixXd>& dn_dx, unsigned phase) noexcept {
   // Define strain rate
   Eigen::Matrix<double, 6, 1> strain_rate = Eigen::Matrix<double, 6, 1>::Zero();
 
@@ -596,7 +648,7 @@ inline Eigen::Matrix<double, 6, 1> mpm::Particle<1>::compute_strain_rate(
 // Compute strain rate of the particle
 template <>
 inline Eigen::Matrix<double, 6, 1> mpm::Particle<2>::compute_strain_rate(
-    const Eigen::MatrixXd& dn_dx, unsigned phase) noexcept {
+    const Eigen::Ref<const Eigen::MatrixXd>& dn_dx, unsigned phase) noexcept {
   // Define strain rate
   Eigen::Matrix<double, 6, 1> strain_rate = Eigen::Matrix<double, 6, 1>::Zero();
 
@@ -616,7 +668,7 @@ inline Eigen::Matrix<double, 6, 1> mpm::Particle<2>::compute_strain_rate(
 // Compute strain rate of the particle
 template <>
 inline Eigen::Matrix<double, 6, 1> mpm::Particle<3>::compute_strain_rate(
-    const Eigen::MatrixXd& dn_dx, unsigned phase) noexcept {
+    const Eigen::Ref<const Eigen::MatrixXd>& dn_dx, unsigned phase) noexcept {
   // Define strain rate
   Eigen::Matrix<double, 6, 1> strain_rate = Eigen::Matrix<double, 6, 1>::Zero();
 
@@ -639,19 +691,26 @@ inline Eigen::Matrix<double, 6, 1> mpm::Particle<3>::compute_strain_rate(
 template <unsigned Tdim>
 void mpm::Particle<Tdim>::compute_strain(double dt) noexcept {
   // Assign strain rate
-  strain_rate_ = this->compute_strain_rate(dn_dx_, mpm::ParticlePhase::Solid);
+  strain_rate_ = this->compute_strain_rate(dn_dx_.template cast<double>(),
+                                           mpm::ParticlePhase::Solid);
   // Update dstrain
   dstrain_ = strain_rate_ * dt;
   // Update strain
   strain_ += dstrain_;
 
   // Compute at centroid
-  // Strain rate for reduced integration
-  const Eigen::Matrix<double, 6, 1> strain_rate_centroid =
-      this->compute_strain_rate(dn_dx_centroid_, mpm::ParticlePhase::Solid);
+  // Volumetric strain rate for reduced integration, shared by the particles
+  // of the cell when the cell has computed it in this step
+  const double volumetric_strain_rate =
+      cell_->volumetric_strain_rate_centroid_computed()
+          ? cell_->volumetric_strain_rate_centroid()
+          : this->compute_strain_rate(cell_->dn_dx_centroid(),
+                                      mpm::ParticlePhase::Solid)
+                .head(Tdim)
+                .sum();
 
   // Assign volumetric strain at centroid
-  dvolumetric_strain_ = dt * strain_rate_centroid.head(Tdim).sum();
+  dvolumetric_strain_ = dt * volumetric_strain_rate;
   volumetric_strain_centroid_ += dvolumetric_strain_;
 }
 
@@ -676,28 +735,30 @@ void mpm::Particle<Tdim>::map_body_force(const VectorDim& pgravity) noexcept {
                                      (pgravity * mass_ * shapefn_(i)));
 }
 
-//! Map internal force
+//! Map internal force of a stress
 template <>
-inline void mpm::Particle<1>::map_internal_force() noexcept {
+inline void mpm::Particle<1>::map_internal_force(
+    const Eigen::Matrix<double, 6, 1>& stress) noexcept {
   // Compute nodal internal forces
   for (unsigned i = 0; i < nodes_.size(); ++i) {
     // Compute force: -pstress * volume
     Eigen::Matrix<double, 1, 1> force;
-    force[0] = -1. * dn_dx_(i, 0) * volume_ * stress_[0];
+    force[0] = -1. * dn_dx_(i, 0) * volume_ * stress[0];
 
     nodes_[i]->update_internal_force(true, mpm::ParticlePhase::Solid, force);
   }
 }
 
-//! Map internal force
+//! Map internal force of a stress
 template <>
-inline void mpm::Particle<2>::map_internal_force() noexcept {
+inline void mpm::Particle<2>::map_internal_force(
+    const Eigen::Matrix<double, 6, 1>& stress) noexcept {
   // Compute nodal internal forces
   for (unsigned i = 0; i < nodes_.size(); ++i) {
     // Compute force: -pstress * volume
     Eigen::Matrix<double, 2, 1> force;
-    force[0] = dn_dx_(i, 0) * stress_[0] + dn_dx_(i, 1) * stress_[3];
-    force[1] = dn_dx_(i, 1) * stress_[1] + dn_dx_(i, 0) * stress_[3];
+    force[0] = dn_dx_(i, 0) * stress[0] + dn_dx_(i, 1) * stress[3];
+    force[1] = dn_dx_(i, 1) * stress[1] + dn_dx_(i, 0) * stress[3];
 
     force *= -1. * this->volume_;
 
@@ -705,21 +766,22 @@ inline void mpm::Particle<2>::map_internal_force() noexcept {
   }
 }
 
-//! Map internal force
+//! Map internal force of a stress
 template <>
-inline void mpm::Particle<3>::map_internal_force() noexcept {
+inline void mpm::Particle<3>::map_internal_force(
+    const Eigen::Matrix<double, 6, 1>& stress) noexcept {
   // Compute nodal internal forces
   for (unsigned i = 0; i < nodes_.size(); ++i) {
     // Compute force: -pstress * volume
     Eigen::Matrix<double, 3, 1> force;
-    force[0] = dn_dx_(i, 0) * stress_[0] + dn_dx_(i, 1) * stress_[3] +
-               dn_dx_(i, 2) * stress_[5];
+    force[0] = dn_dx_(i, 0) * stress[0] + dn_dx_(i, 1) * stress[3] +
+               dn_dx_(i, 2) * stress[5];
 
-    force[1] = dn_dx_(i, 1) * stress_[1] + dn_dx_(i, 0) * stress_[3] +
-               dn_dx_(i, 2) * stress_[4];
+    force[1] = dn_dx_(i, 1) * stress[1] + dn_dx_(i, 0) * stress[3] +
+               dn_dx_(i, 2) * stress[4];
 
-    force[2] = dn_dx_(i, 2) * stress_[2] + dn_dx_(i, 1) * stress_[4] +
-               dn_dx_(i, 0) * stress_[5];
+    force[2] = dn_dx_(i, 2) * stress[2] + dn_dx_(i, 1) * stress[4] +
+               dn_dx_(i, 0) * stress[5];
 
     force *= -1. * this->volume_;
 
@@ -727,6 +789,42 @@ inline void mpm::Particle<3>::map_internal_force() noexcept {
   }
 }
 
+//! Map internal force
+template <unsigned Tdim>
+inline void mpm::Particle<Tdim>::map_internal_force() noexcept {
+  this->map_internal_force(stress_);
+}
+
+//! Map internal force of a trial stress
+template <unsigned Tdim>
+void mpm::Particle<Tdim>::map_trial_internal_force(double dt) noexcept {
+  // Check if material ptr is valid
+  assert(this->material() != nullptr);
+  // Strain increment of the nodal velocity
+  const Eigen::Matrix<double, 6, 1> dstrain =
+      dt * this->compute_strain_rate(dn_dx_.template cast<double>(),
+                                     mpm::ParticlePhase::Solid);
+  // Trial stress updates the scratch state variables, whose values are
+  // reset in place to avoid copying the map in each iteration
+  const auto& state_vars = state_variables_[mpm::ParticlePhase::Solid];
+  if (trial_state_variables_.size() != state_vars.size())
+    trial_state_variables_ = state_vars;
+  else {
+    for (const auto& state_var : state_vars) {
+      auto itr = trial_state_variables_.find(state_var.first);
+      if (itr == trial_state_variables_.end()) {
+        trial_state_variables_ = state_vars;
+        break;
+      }
+      itr.value() = state_var.second;
+    }
+  }
+  const Eigen::Matrix<double, 6, 1> stress =
+      (this->material())->compute_trial_stress(stress_, dstrain, this,
+                                               &trial_state_variables_);
+  this->map_internal_force(stress);
+}
+
 // Assign velocity to the particle
 template <unsigned Tdim>
 bool mpm::Particle<Tdim>::assign_velocity(
@@ -804,6 +902,55 @@ void mpm::Particle<Tdim>::compute_updated_position(
   this->displacement_ += nodal_velocity * dt;
 }
 
+//! Map mass weighted acceleration to nodes
+template <unsigned Tdim>
+void mpm::Particle<Tdim>::map_acceleration_to_nodes() noexcept {
+  // Check if particle mass is set
+  assert(mass_ != std::numeric_limits<double>::max());
+
+  for (unsigned i = 0; i < nodes_.size(); ++i)
+    nodes_[i]->update_acceleration(true, mpm::ParticlePhase::Solid,
+                                   mass_ * shapefn_[i] * acceleration_);
+}
+
+//! Interpolate the nodal acceleration to the particle
+template <unsigned Tdim>
+void mpm::Particle<Tdim>::interpolate_acceleration() noexcept {
+  acceleration_.setZero();
+  for (unsigned i = 0; i < nodes_.size(); ++i)
+    acceleration_ +=
+        shapefn_[i] * nodes_[i]->acceleration(mpm::ParticlePhase::Solid);
+}
+
+// Compute updated position of the particle with Newmark integration
+template <unsigned Tdim>
+void mpm::Particle<Tdim>::compute_updated_position_newmark(
+    double dt, double gamma) noexcept {
+  // Check if particle has a valid cell ptr
+  assert(cell_ != nullptr);
+  // Interpolated nodal displacement increment and acceleration
+  Eigen::Matrix<double, Tdim, 1> nodal_displacement =
+      Eigen::Matrix<double, Tdim, 1>::Zero();
+  Eigen::Matrix<double, Tdim, 1> nodal_acceleration =
+      Eigen::Matrix<double, Tdim, 1>::Zero();
+  for (unsigned i = 0; i < nodes_.size(); ++i) {
+    nodal_displacement +=
+        shapefn_[i] * dt * nodes_[i]->velocity(mpm::ParticlePhase::Solid);
+    nodal_acceleration +=
+        shapefn_[i] * nodes_[i]->acceleration(mpm::ParticlePhase::Solid);
+  }
+
+  // Newmark velocity update from the accelerations at both ends of the step
+  this->velocity_ +=
+      dt * ((1. - gamma) * acceleration_ + gamma * nodal_acceleration);
+  this->acceleration_ = nodal_acceleration;
+
+  // New position current position + displacement increment
+  this->coordinates_ += nodal_displacement;
+  // Update displacement (displacement is initialized from zero)
+  this->displacement_ += nodal_displacement;
+}
+
 //! Map particle pressure to nodes
 template <unsigned Tdim>
 bool mpm::Particle<Tdim>::map_pressure_to_nodes(unsigned phase) noexcept {
@@ -859,32 +1006,29 @@ void mpm::Particle<Tdim>::apply_particle_velocity_constraints(unsigned dir,
 template <unsigned Tdim>
 inline double mpm::Particle<Tdim>::scalar_data(
     const std::string& property) const {
-  return (this->scalar_properties_.find(property) !=
-          this->scalar_properties_.end())
-             ? this->scalar_properties_.at(property)()
-             : std::numeric_limits<double>::quiet_NaN();
+  const auto accessor = ParticleBase<Tdim>::scalar_accessor(property);
+  return (accessor != nullptr) ? (this->*accessor)()
+                               : std::numeric_limits<double>::quiet_NaN();
 }
 
 //! Return particle vector data
 template <unsigned Tdim>
 inline Eigen::Matrix<double, Tdim, 1> mpm::Particle<Tdim>::vector_data(
     const std::string& property) const {
-  return (this->vector_properties_.find(property) !=
-          this->vector_properties_.end())
-             ? this->vector_properties_.at(property)()
-             : Eigen::Matrix<double, Tdim, 1>::Constant(
-                   std::numeric_limits<double>::quiet_NaN());
+  const auto accessor = ParticleBase<Tdim>::vector_accessor(property);
+  return (accessor != nullptr) ? (this->*accessor)()
+                               : Eigen::Matrix<double, Tdim, 1>::Constant(
+                                     std::numeric_limits<double>::quiet_NaN());
 }
 
 //! Return particle tensor data
 template <unsigned Tdim>
 inline Eigen::VectorXd mpm::Particle<Tdim>::tensor_data(
     const std::string& property) const {
-  return (this->tensor_properties_.find(property) !=
-          this->tensor_properties_.end())
-             ? this->tensor_properties_.at(property)()
-             : Eigen::Matrix<double, 6, 1>::Constant(
-                   std::numeric_limits<double>::quiet_NaN());
+  const auto accessor = ParticleBase<Tdim>::tensor_accessor(property);
+  return (accessor != nullptr) ? (this->*accessor)()
+                               : Eigen::Matrix<double, 6, 1>::Constant(
+                                     std::numeric_limits<double>::quiet_NaN());
 }
 
 //! Assign material id of this particle to nodes
@@ -894,13 +1038,40 @@ void mpm::Particle<Tdim>::append_material_id_to_nodes() const {
     nodes_[i]->append_material_id(this->material_id());
 }
 
-//! Assign neighbour particles
+//! Assign the cell list of neighbour particles
 template <unsigned Tdim>
 void mpm::Particle<Tdim>::assign_neighbours(
-    const std::vector<mpm::Index>& neighbours) {
-  neighbours_ = neighbours;
-  neighbours_.erase(std::remove(neighbours_.begin(), neighbours_.end(), id_),
-                    neighbours_.end());
+    const std::shared_ptr<const mpm::CellList>& cell_list) {
+  cell_list_ = cell_list;
+}
+
+//! Return ranges of particle ids of the cell and its neighbour cells
+template <unsigned Tdim>
+std::vector<mpm::CellList::Range> mpm::Particle<Tdim>::neighbour_ranges()
+    const {
+  if (cell_list_ == nullptr || !cell_list_->contains(cell_id_)) return {};
+  return cell_list_->neighbour_ranges(cell_id_);
+}
+
+//! Return the number of neighbour particles
+template <unsigned Tdim>
+unsigned mpm::Particle<Tdim>::nneighbours() const {
+  if (cell_list_ == nullptr || !cell_list_->contains(cell_id_)) return 0;
+  // Particle itself is in the range of its cell
+  return cell_list_->nneighbours(cell_id_) - 1;
+}
+
+//! Return neighbour ids
+template <unsigned Tdim>
+std::vector<mpm::Index> mpm::Particle<Tdim>::neighbours() const {
+  std::vector<mpm::Index> neighbours;
+  if (cell_list_ == nullptr || !cell_list_->contains(cell_id_))
+    return neighbours;
+  neighbours.reserve(cell_list_->nneighbours(cell_id_));
+  cell_list_->iterate_over_neighbours(cell_id_, [&](mpm::Index pid) {
+    if (pid != id_) neighbours.emplace_back(pid);
+  });
+  return neighbours;
 }
 
 //! Compute size of serialized particle data
@@ -8,14 +8,18 @@
 
 #include <array>
 #include <limits>
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "cell.h"
+#include "cell_list.h"
 #include "data_types.h"
 #include "function_base.h"
 #include "hdf5_particle.h"
 #include "material.h"
+#include "shapefn_cache.h"
 
 namespace mpm {
 
@@ -39,6 +43,13 @@ class ParticleBase {
  public:
   //! Define a vector of size dimension
   using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+  //! Accessor of a scalar attribute
+  using ScalarAccessor = double (ParticleBase<Tdim>::*)() const;
+  //! Accessor of a vector attribute
+  using VectorAccessor = VectorDim (ParticleBase<Tdim>::*)() const;
+  //! Accessor of a tensor attribute
+  using TensorAccessor =
+      Eigen::Matrix<double, 6, 1> (ParticleBase<Tdim>::*)() const;
 
   //! Constructor with id and coordinates
   //! \param[in] id Particle id
@@ -126,6 +137,13 @@ class ParticleBase {
   //! Compute shape functions
   virtual void compute_shapefn() noexcept = 0;
 
+  //! Assign a slot of a shape function cache
+  //! \param[in] cache Shape function cache of the mesh
+  //! \param[in] index Index of the particle slot in the cache
+  virtual void assign_shapefn_cache(
+      const std::shared_ptr<mpm::ShapefnCache>& cache,
+      mpm::Index index) noexcept = 0;
+
   //! Assign volume
   virtual bool assign_volume(double volume) = 0;
 
@@ -163,6 +181,11 @@ class ParticleBase {
   virtual bool assign_material(const std::shared_ptr<Material<Tdim>>& material,
                                unsigned phase = mpm::ParticlePhase::Solid) = 0;
 
+  //! Replace material keeping state variables with the same name
+  virtual bool replace_material(
+      const std::shared_ptr<Material<Tdim>>& material,
+      unsigned phase = mpm::ParticlePhase::Solid) = 0;
+
   //! Return material of particle
   //! \param[in] phase Index to indicate material phase
   std::shared_ptr<Material<Tdim>> material(
@@ -183,6 +206,13 @@ class ParticleBase {
     return state_variables_[phase];
   }
 
+  //! Return pointer to state variables for update
+  //! \param[in] phase Index to indicate material phase
+  mpm::dense_map* state_variables_ptr(
+      unsigned phase = mpm::ParticlePhase::Solid) {
+    return &state_variables_[phase];
+  }
+
   //! Assign status
   void assign_status(bool status) { status_ = status; }
 
@@ -210,6 +240,9 @@ class ParticleBase {
   //! Strain rate
   virtual Eigen::Matrix<double, 6, 1> strain_rate() const = 0;
 
+  //! Strain increment
+  virtual Eigen::Matrix<double, 6, 1> dstrain() const = 0;
+
   //! Volumetric strain of centroid
   virtual double volumetric_strain_centroid() const = 0;
 
@@ -222,6 +255,9 @@ class ParticleBase {
   //! Compute stress
   virtual void compute_stress() noexcept = 0;
 
+  //! Assign stress updated by the material
+  virtual void update_stress(const Eigen::Matrix<double, 6, 1>&) noexcept = 0;
+
   //! Return stress
   virtual Eigen::Matrix<double, 6, 1> stress() const = 0;
 
@@ -231,6 +267,9 @@ class ParticleBase {
   //! Map internal force
   virtual void map_internal_force() noexcept = 0;
 
+  //! Map internal force of a trial stress from the nodal velocity
+  virtual void map_trial_internal_force(double dt) noexcept = 0;
+
   //! Map particle pressure to nodes
   virtual bool map_pressure_to_nodes(
       unsigned phase = mpm::ParticlePhase::Solid) noexcept = 0;
@@ -248,6 +287,15 @@ class ParticleBase {
   //! Return displacement of the particle
   virtual VectorDim displacement() const = 0;
 
+  //! Return acceleration
+  virtual VectorDim acceleration() const = 0;
+
+  //! Map mass weighted acceleration to nodes
+  virtual void map_acceleration_to_nodes() noexcept = 0;
+
+  //! Interpolate the nodal acceleration to the particle
+  virtual void interpolate_acceleration() noexcept = 0;
+
   //! Assign traction
   virtual bool assign_traction(unsigned direction, double traction) = 0;
 
@@ -261,6 +309,10 @@ class ParticleBase {
   virtual void compute_updated_position(
       double dt, bool velocity_update = false) noexcept = 0;
 
+  //! Compute updated position with Newmark integration
+  virtual void compute_updated_position_newmark(double dt,
+                                                double gamma) noexcept = 0;
+
   //! Return a state variable
   virtual double state_variable(
       const std::string& var,
@@ -281,6 +333,21 @@ class ParticleBase {
   //! \retval data Tensor data of particle property
   virtual Eigen::VectorXd tensor_data(const std::string& property) const = 0;
 
+  //! Return the accessor of a scalar attribute
+  //! \param[in] attribute Name of the attribute
+  //! \retval accessor Member accessor, nullptr if it is not registered
+  static ScalarAccessor scalar_accessor(const std::string& attribute);
+
+  //! Return the accessor of a vector attribute
+  //! \param[in] attribute Name of the attribute
+  //! \retval accessor Member accessor, nullptr if it is not registered
+  static VectorAccessor vector_accessor(const std::string& attribute);
+
+  //! Return the accessor of a tensor attribute
+  //! \param[in] attribute Name of the attribute
+  //! \retval accessor Member accessor, nullptr if it is not registered
+  static TensorAccessor tensor_accessor(const std::string& attribute);
+
   //! Apply particle velocity constraints
   //! \param[in] dir Direction of particle velocity constraint
   //! \param[in] velocity Applied particle velocity constraint
@@ -293,10 +360,15 @@ class ParticleBase {
   //! Return the number of neighbour particles
   virtual unsigned nneighbours() const = 0;
 
-  //! Assign neighbour particles
-  //! \param[in] neighbours set of id of the neighbouring particles
-  //! \retval insertion_status Return the successful addition of a node
-  virtual void assign_neighbours(const std::vector<mpm::Index>& neighbours) = 0;
+  //! Assign the cell list of neighbour particles
+  //! \param[in] cell_list Cell list with the particles of the particle cell
+  //! and its neighbour cells
+  virtual void assign_neighbours(
+      const std::shared_ptr<const mpm::CellList>& cell_list) = 0;
+
+  //! Return ranges of particle ids of the particle cell and its neighbour
+  //! cells, including the particle itself
+  virtual std::vector<mpm::CellList::Range> neighbour_ranges() const = 0;
 
   //! Return neighbour ids
   virtual std::vector<mpm::Index> neighbours() const = 0;
@@ -328,16 +400,16 @@ class ParticleBase {
   Eigen::Matrix<double, Tdim, 1> xi_;
   //! Cell
   std::shared_ptr<Cell<Tdim>> cell_;
-  //! Vector of nodal pointers
-  std::vector<std::shared_ptr<NodeBase<Tdim>>> nodes_;
+  //! Vector of nodal pointers, owned by the cell
+  std::vector<NodeBase<Tdim>*> nodes_;
   //! Material
   std::vector<std::shared_ptr<Material<Tdim>>> material_;
   //! Unsigned material id
   std::vector<unsigned> material_id_;
   //! Material state history variables
   std::vector<mpm::dense_map> state_variables_;
-  //! Vector of particle neighbour ids
-  std::vector<mpm::Index> neighbours_;
+  //! Cell list of neighbour particles
+  std::shared_ptr<const mpm::CellList> cell_list_{nullptr};
 };  // ParticleBase class
 }  // namespace mpm
 
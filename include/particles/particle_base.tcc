@@ -15,3 +15,40 @@ mpm::ParticleBase<Tdim>::ParticleBase(Index id, const VectorDim& coord,
     : mpm::ParticleBase<Tdim>::ParticleBase(id, coord) {
   status_ = status;
 }
+
+//! Return the accessor of a scalar attribute
+template <unsigned Tdim>
+typename mpm::ParticleBase<Tdim>::ScalarAccessor
+    mpm::ParticleBase<Tdim>::scalar_accessor(const std::string& attribute) {
+  // Attribute registry of particles
+  static const std::map<std::string, ScalarAccessor> accessors = {
+      {"mass", &ParticleBase<Tdim>::mass},
+      {"volume", &ParticleBase<Tdim>::volume},
+      {"mass_density", &ParticleBase<Tdim>::mass_density}};
+  const auto itr = accessors.find(attribute);
+  return (itr != accessors.end()) ? itr->second : nullptr;
+}
+
+//! Return the accessor of a vector attribute
+template <unsigned Tdim>
+typename mpm::ParticleBase<Tdim>::VectorAccessor
+    mpm::ParticleBase<Tdim>::vector_accessor(const std::string& attribute) {
+  // Attribute registry of particles
+  static const std::map<std::string, VectorAccessor> accessors = {
+      {"displacements", &ParticleBase<Tdim>::displacement},
+      {"velocities", &ParticleBase<Tdim>::velocity}};
+  const auto itr = accessors.find(attribute);
+  return (itr != accessors.end()) ? itr->second : nullptr;
+}
+
+//! Return the accessor of a tensor attribute
+template <unsigned Tdim>
+typename mpm::ParticleBase<Tdim>::TensorAccessor
+    mpm::ParticleBase<Tdim>::tensor_accessor(const std::string& attribute) {
+  // Attribute registry of particles
+  static const std::map<std::string, TensorAccessor> accessors = {
+      {"stresses", &ParticleBase<Tdim>::stress},
+      {"strains", &ParticleBase<Tdim>::strain}};
+  const auto itr = accessors.find(attribute);
+  return (itr != accessors.end()) ? itr->second : nullptr;
+}
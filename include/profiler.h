@@ -0,0 +1,141 @@
+#ifndef MPM_PROFILER_H_
+#define MPM_PROFILER_H_
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "json.hpp"
+
+#include "mutex.h"
+
+using Json = nlohmann::json;
+
+namespace mpm {
+
+// Profiler class
+//! \brief Scoped timers and counters of solver phases
+//! \details Timers nest by scope into paths such as "step/forces" and are
+//! summed over calls and OpenMP threads of a rank, counters are summed. The
+//! report reduces each entry to min, mean and max over MPI ranks. When the
+//! profiler is disabled a scoped timer or counter only checks a flag.
+class Profiler {
+ public:
+  //! Return the profiler of the process
+  static Profiler* instance();
+
+  //! Enable or disable the profiler
+  //! \param[in] status Profiler status
+  void enable(bool status) { enabled_ = status; }
+
+  //! Return if the profiler is enabled
+  bool enabled() const { return enabled_; }
+
+  //! Enter a scope of the calling thread
+  //! \param[in] name Name of the scope
+  //! \retval path Path of the scope
+  std::string push_scope(const char* name);
+
+  //! Leave the innermost scope of the calling thread
+  void pop_scope();
+
+  //! Add elapsed time to a timer
+  //! \param[in] path Path of the timer
+  //! \param[in] seconds Elapsed time in seconds
+  void add_time(const std::string& path, double seconds);
+
+  //! Add to a counter
+  //! \param[in] name Name of the counter
+  //! \param[in] value Value to add
+  void add_count(const std::string& name, double value);
+
+  //! Clear timers and counters
+  void reset();
+
+  //! Return the time of a timer on this rank
+  //! \param[in] path Path of the timer
+  double time(const std::string& path) const;
+
+  //! Return the number of calls of a timer on this rank
+  //! \param[in] path Path of the timer
+  unsigned long long ncalls(const std::string& path) const;
+
+  //! Return the value of a counter on this rank
+  //! \param[in] name Name of the counter
+  double count(const std::string& name) const;
+
+  //! Report of timers and counters reduced over MPI ranks
+  //! \details Collective over MPI ranks, entries are those of rank 0
+  Json report() const;
+
+  //! Write the report as <filename>.json and <filename>.csv on rank 0
+  //! \details Collective over MPI ranks
+  //! \param[in] filename File name without extension
+  bool write(const std::string& filename) const;
+
+ private:
+  //! Timer
+  struct Timer {
+    //! Elapsed time
+    double seconds{0.};
+    //! Number of calls
+    unsigned long long ncalls{0};
+  };
+
+  //! Profiler status
+  std::atomic<bool> enabled_{false};
+  //! Mutex of timers and counters
+  mutable SpinMutex mutex_;
+  //! Timers
+  std::map<std::string, Timer> timers_;
+  //! Counters
+  std::map<std::string, double> counters_;
+};  // Profiler class
+
+// Scoped timer class
+//! \brief Time a scope with the process profiler
+class ScopedTimer {
+ public:
+  //! Constructor with the name of the scope
+  //! \param[in] name Name of the scope
+  explicit ScopedTimer(const char* name) {
+    auto profiler = Profiler::instance();
+    if (profiler->enabled()) {
+      active_ = true;
+      path_ = profiler->push_scope(name);
+      begin_ = std::chrono::steady_clock::now();
+    }
+  }
+
+  //! Destructor records the elapsed time
+  ~ScopedTimer() {
+    if (active_) {
+      const std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - begin_;
+      auto profiler = Profiler::instance();
+      profiler->pop_scope();
+      profiler->add_time(path_, elapsed.count());
+    }
+  }
+
+  //! Delete copy constructor
+  ScopedTimer(const ScopedTimer&) = delete;
+
+  //! Delete assignement operator
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+ private:
+  //! Timer is recording
+  bool active_{false};
+  //! Path of the timer
+  std::string path_;
+  //! Start time
+  std::chrono::steady_clock::time_point begin_;
+};  // ScopedTimer class
+
+}  // namespace mpm
+
+#endif  // MPM_PROFILER_H_
@@ -0,0 +1,91 @@
+#ifndef MPM_SHAPEFN_CACHE_H_
+#define MPM_SHAPEFN_CACHE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+#include "data_types.h"
+
+namespace mpm {
+
+// Shape function cache class
+//! \brief Fixed stride storage of particle shape functions and gradients
+//! \details Each particle owns one slot of nfunctions shape functions and an
+//! nfunctions x dim column-major block of gradients, where nfunctions is the largest number of shape functions of any cell in
+//! the mesh. The mesh fills the cache in one pass and particles read and
+//! write their slots in place. Slots are indexed by the position of the
+//! particle in the mesh, so the mesh clears the cache when particles are
+//! added or removed and assigns the slots again in the next pass.
+class ShapefnCache {
+ public:
+  //! Resize the cache
+  //! \details Storage is reallocated only when it grows and is then first
+  //! touched by a static partition of the particle slots, which places the
+  //! pages of a slot on the NUMA node of the thread that works on it
+  //! \param[in] nparticles Number of particles
+  //! \param[in] nfunctions Maximum number of shape functions of a particle
+  //! \param[in] dim Dimension
+  void resize(mpm::Index nparticles, unsigned nfunctions, unsigned dim) {
+    nparticles_ = nparticles;
+    nfunctions_ = nfunctions;
+    dim_ = dim;
+    const std::size_t size = nparticles_ * nfunctions_;
+    if (size > capacity_ || size * dim_ > gradient_capacity_) {
+      // Uninitialised storage
+      shapefn_.reset(new mpm::StorageReal[size]);
+      dn_dx_.reset(new mpm::StorageReal[size * dim_]);
+      capacity_ = size;
+      gradient_capacity_ = size * dim_;
+
+      const long nslots = static_cast<long>(nparticles_);
+      const std::size_t stride = nfunctions_;
+#pragma omp parallel for schedule(static)
+      for (long i = 0; i < nslots; ++i) {
+        std::fill_n(shapefn_.get() + i * stride, stride, 0.);
+        std::fill_n(dn_dx_.get() + i * stride * dim, stride * dim, 0.);
+      }
+    }
+  }
+
+  //! Invalidate all the particle slots and keep the storage
+  void clear() { nparticles_ = 0; }
+
+  //! Number of particle slots
+  mpm::Index nparticles() const { return nparticles_; }
+
+  //! Maximum number of shape functions of a particle
+  unsigned nfunctions() const { return nfunctions_; }
+
+  //! Return shape functions of a particle slot
+  //! \param[in] index Index of the particle slot
+  mpm::StorageReal* shapefn(mpm::Index index) {
+    return shapefn_.get() + index * nfunctions_;
+  }
+
+  //! Return shape function gradients of a particle slot
+  //! \param[in] index Index of the particle slot
+  mpm::StorageReal* dn_dx(mpm::Index index) {
+    return dn_dx_.get() + index * nfunctions_ * dim_;
+  }
+
+ private:
+  //! Number of particle slots
+  mpm::Index nparticles_{0};
+  //! Maximum number of shape functions of a particle
+  unsigned nfunctions_{0};
+  //! Dimension
+  unsigned dim_{0};
+  //! Allocated number of shape functions
+  std::size_t capacity_{0};
+  //! Allocated number of shape function gradients
+  std::size_t gradient_capacity_{0};
+  //! Shape functions
+  std::unique_ptr<mpm::StorageReal[]> shapefn_{nullptr};
+  //! Shape function gradients
+  std::unique_ptr<mpm::StorageReal[]> dn_dx_{nullptr};
+};  // ShapefnCache class
+
+}  // namespace mpm
+
+#endif  // MPM_SHAPEFN_CACHE_H_
@@ -0,0 +1,88 @@
+#ifndef MPM_BICGSTAB_H_
+#define MPM_BICGSTAB_H_
+
+#include <cmath>
+#include <limits>
+
+#include "Eigen/Dense"
+
+namespace mpm {
+
+//! Solve a linear system with the stabilised biconjugate gradient method
+//! \details The operator is only applied to vectors, so the matrix of the
+//! system is never assembled. The inner product is supplied by the caller,
+//! which weights and reduces entries of vectors distributed over MPI ranks.
+//! \param[in] apply Operator returning the product of the matrix and a vector
+//! \param[in] dot Inner product of two vectors
+//! \param[in] rhs Right hand side of the system
+//! \param[in,out] x Initial guess and solution
+//! \param[in] max_iterations Maximum number of iterations
+//! \param[in] tolerance Tolerance of the residual norm relative to the rhs
+//! \param[out] iterations Number of iterations
+//! \retval status Residual norm is below the tolerance
+//! \tparam Toperator Callable of a vector returning a vector
+//! \tparam Tdot Callable of two vectors returning a scalar
+template <typename Toperator, typename Tdot>
+bool bicgstab(const Toperator& apply, const Tdot& dot,
+              const Eigen::VectorXd& rhs, Eigen::VectorXd* x,
+              unsigned max_iterations, double tolerance,
+              unsigned* iterations) {
+  *iterations = 0;
+  const double rhs_norm = std::sqrt(dot(rhs, rhs));
+  // Zero right hand side has the zero solution
+  if (rhs_norm == 0.) {
+    x->setZero();
+    return true;
+  }
+  const double threshold = tolerance * rhs_norm;
+
+  Eigen::VectorXd r = rhs - apply(*x);
+  if (std::sqrt(dot(r, r)) <= threshold) return true;
+
+  // Shadow residual
+  const Eigen::VectorXd rhat = r;
+  Eigen::VectorXd p = Eigen::VectorXd::Zero(rhs.size());
+  Eigen::VectorXd v = Eigen::VectorXd::Zero(rhs.size());
+  double rho = 1., alpha = 1., omega = 1.;
+  const double breakdown = std::numeric_limits<double>::min();
+
+  for (; *iterations < max_iterations; ++(*iterations)) {
+    const double rho_new = dot(rhat, r);
+    if (std::fabs(rho_new) < breakdown) return false;
+    const double beta = (rho_new / rho) * (alpha / omega);
+    rho = rho_new;
+
+    p = r + beta * (p - omega * v);
+    v = apply(p);
+    const double rhat_v = dot(rhat, v);
+    if (std::fabs(rhat_v) < breakdown) return false;
+    alpha = rho / rhat_v;
+
+    // Half step
+    const Eigen::VectorXd s = r - alpha * v;
+    if (std::sqrt(dot(s, s)) <= threshold) {
+      *x += alpha * p;
+      ++(*iterations);
+      return true;
+    }
+
+    // Stabilising step
+    const Eigen::VectorXd t = apply(s);
+    const double t_t = dot(t, t);
+    if (t_t < breakdown) return false;
+    omega = dot(t, s) / t_t;
+
+    *x += alpha * p + omega * s;
+    r = s - omega * t;
+    if (std::sqrt(dot(r, r)) <= threshold) {
+      ++(*iterations);
+      return true;
+    }
+    if (std::fabs(omega) < breakdown) return false;
+  }
+  return false;
+}
+
+}  // namespace mpm
+
+#endif  // MPM_BICGSTAB_H_
@@ -88,6 +88,8 @@ class MPM {
   double dt_{std::numeric_limits<double>::max()};
   //! Current step
   mpm::Index step_{0};
+  //! Current time
+  double time_{0.};
   //! Number of steps
   mpm::Index nsteps_{std::numeric_limits<mpm::Index>::max()};
   //! Output steps
@@ -1,6 +1,10 @@
 #ifndef MPM_MPM_BASE_H_
 #define MPM_MPM_BASE_H_
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
 #include <numeric>
 
 #include <boost/lexical_cast.hpp>
@@ -17,6 +21,7 @@
 #include "graph.h"
 #endif
 
+#include "checkpoint.h"
 #include "constraints.h"
 #include "contact.h"
 #include "contact_friction.h"
@@ -25,6 +30,7 @@
 #include "mpm_scheme_usf.h"
 #include "mpm_scheme_usl.h"
 #include "particle.h"
+#include "quasi_static.h"
 #include "vector.h"
 
 namespace mpm {
@@ -84,6 +90,28 @@ class MPMBase : public MPM {
   //! Write HDF5 files
   void write_hdf5(mpm::Index step, mpm::Index max_steps) override;
 
+  //! Write the restart checkpoint of the current step
+  //! \details Checkpoints are written every checkpoint steps, independent of
+  //! the visualisation outputs, if checkpoints are enabled. Full snapshots
+  //! also store the partition and the particles of cells.
+  //! \param[in] force Write the checkpoint at any step
+  void write_checkpoint(bool force = false);
+
+  //! Return the state of the solver to resume an analysis from
+  //! \retval state Time, time step size, next output time, the stage with
+  //! its start and end steps, and the damping and convergence of
+  //! quasi-static steps
+  Json solver_state() const;
+
+  //! Restore the state of the solver read by checkpoint resume, a resumed
+  //! output without solver state and a new analysis start from the fixed
+  //! time steps
+  void restore_solver_state();
+
+  //! Return if the partition of cells is restored by checkpoint resume
+  //! \retval partition_restored Partition is restored on all MPI ranks
+  bool partition_restored() const { return partition_restored_; }
+
   //! Domain decomposition
   //! \param[in] initial_step Start of simulation or later steps
   void mpi_domain_decompose(bool initial_step = false) override;
@@ -92,7 +120,80 @@ class MPMBase : public MPM {
   //! \param[in] phase Phase to smooth pressure
   void pressure_smoothing(unsigned phase);
 
+  //! Log stress update statistics of materials since the previous log and
+  //! reset them
+  //! \param[in] mpi_rank MPI rank
+  void log_material_statistics(int mpi_rank);
+
+  //! Write the report of the profiler as JSON and CSV, if it is enabled
+  void write_profile();
+
+  //! Compute the time step size of the current step
+  //! \details Fixed dt unless adaptive time stepping is enabled, in which
+  //! case the critical time step is reduced over all MPI ranks, enlarged by
+  //! the square root of the mass scaling of quasi-static steps and limited
+  //! by the Courant number, growth ratio and dt bounds
+  //! \param[in] phase Phase to compute the critical time step
+  //! \retval dt Time step size
+  double time_step(unsigned phase);
+
+  //! Check if outputs are written in the current step
+  //! \details Adaptive time stepping with an output interval writes outputs
+  //! at the first step past each output time, otherwise every output_steps
+  bool output_step();
+
+  //! Check the equilibrium of a quasi-static step
+  //! \details Reduces the unbalanced and external nodal forces and the
+  //! kinetic energy over all MPI ranks to update the quasi-static damping,
+  //! and resets particle velocities at peaks of the kinetic energy
+  //! \param[in] phase Phase of the nodal forces
+  //! \retval converged Quasi-static steps have converged to equilibrium
+  bool quasi_static_converged(unsigned phase);
+
+  //! Return the number of stages, an analysis without stages is one stage
+  unsigned nstages() const {
+    return std::max<unsigned>(1, static_cast<unsigned>(stages_.size()));
+  }
+
+  //! Initialise a stage of the analysis
+  //! \details The mesh, its partition and the particles are kept. Boundary
+  //! conditions and loads of the stage replace the current ones, materials of
+  //! the stage are added or replace materials with the same id keeping the
+  //! state variables of particles, particle sets are assigned materials or
+  //! removed, and dt, solver options and damping are updated. A stage without
+  //! quasi-static steps uses those of the analysis, if any. The stage ends
+  //! nsteps of the stage after its start.
+  //! \param[in] stage Index of the stage
+  //! \param[in] start_step Step at which the stage starts
+  //! \retval status Stage is initialised
+  bool initialise_stage(unsigned stage, mpm::Index start_step);
+
+  //! Return the mesh of the analysis
+  std::shared_ptr<mpm::Mesh<Tdim>> mesh() const { return mesh_; }
+
  private:
+  //! Write the state of the solver as an attribute of an HDF5 file
+  //! \param[in] filename Name of the HDF5 file of the step
+  void write_solver_state(const std::string& filename) const;
+
+  //! Read the state of the solver from an HDF5 file
+  //! \param[in] filename Name of the HDF5 file of the step
+  //! \retval state State of the solver, empty if the file has none
+  Json read_solver_state(const std::string& filename) const;
+
+  //! Check if the particle table of an HDF5 file is in single precision
+  //! \param[in] filename Name of the HDF5 particles file
+  //! \retval single_precision Real fields of the table are floats
+  bool single_precision_hdf5(const std::string& filename) const;
+
+ private:
+  //! Initialise adaptive time stepping
+  //! \param[in] adaptive_props Adaptive time stepping parameters
+  bool initialise_adaptive_time_stepping(const Json& adaptive_props);
+
+  //! Compute elastic wave speeds of materials
+  void compute_wave_speeds();
+
   //! Return if a mesh will be isoparametric or not
   //! \retval isoparametric Status of mesh type
   bool is_isoparametric();
@@ -160,6 +261,14 @@ class MPMBase : public MPM {
   //! \param[in] damping_props Damping properties
   bool initialise_damping(const Json& damping_props);
 
+  //! Assign materials to particle sets
+  //! \param[in] material_sets Material, phase and particle set ids
+  void assign_material_sets(const Json& material_sets);
+
+  //! Assign gravity, particle tractions and nodal concentrated forces
+  //! \param[in] loads External loading conditions
+  void assign_loads(const Json& loads);
+
  protected:
   // Generate a unique id for the analysis
   using mpm::MPM::uuid_;
@@ -167,6 +276,8 @@ class MPMBase : public MPM {
   using mpm::MPM::dt_;
   //! Current step
   using mpm::MPM::step_;
+  //! Current time
+  using mpm::MPM::time_;
   //! Number of steps
   using mpm::MPM::nsteps_;
   //! Output steps
@@ -210,8 +321,47 @@ class MPMBase : public MPM {
   mpm::Damping damping_type_{mpm::Damping::None};
   //! Damping factor
   double damping_factor_{0.};
+  //! Quasi-static steps with dynamic relaxation
+  std::shared_ptr<mpm::QuasiStatic> quasi_static_{nullptr};
+  //! Stages of the analysis
+  std::vector<Json> stages_;
+  //! Current stage
+  unsigned stage_{0};
+  //! Step at which the current stage starts
+  mpm::Index stage_start_{0};
+  //! Step at which the current stage ends
+  mpm::Index stage_end_{std::numeric_limits<mpm::Index>::max()};
+  //! Incremental restart checkpoints
+  std::shared_ptr<mpm::Checkpoint> checkpoint_{nullptr};
+  //! Number of steps between checkpoints
+  mpm::Index checkpoint_steps_{1};
+  //! Partition of cells is restored from a checkpoint
+  bool partition_restored_{false};
+  //! State of the solver read by checkpoint resume
+  Json resume_state_;
   //! Locate particles
   bool locate_particles_{true};
+  //! Adaptive time stepping
+  bool adaptive_time_{false};
+  //! Courant number of the adaptive time step
+  double courant_number_{0.5};
+  //! Maximum ratio of consecutive adaptive time steps
+  double dt_growth_{1.2};
+  //! Minimum adaptive time step
+  double dt_min_{0.};
+  //! Maximum adaptive time step
+  double dt_max_{std::numeric_limits<double>::max()};
+  //! Final time of adaptive time stepping
+  double final_time_{std::numeric_limits<double>::max()};
+  //! Output interval in simulation time
+  double output_interval_{0.};
+  //! Next output time
+  double next_output_time_{0.};
+  //! Particle output with real fields in single precision, such output
+  //! cannot resume the analysis
+  bool single_precision_output_{false};
+  //! Elastic wave speeds of materials
+  std::map<unsigned, double> wave_speeds_;
 
 #ifdef USE_GRAPH_PARTITIONING
   // graph pass the address of the container of cell
@@ -46,6 +46,26 @@ mpm::MPMBase<Tdim>::MPMBase(const std::shared_ptr<IO>& io) : mpm::MPM(io) {
       nload_balance_steps_ =
           analysis_["nload_balance_steps"].template get<mpm::Index>();
 
+    // Adaptive time stepping
+    if (analysis_.find("adaptive_time_stepping") != analysis_.end()) {
+      if (!initialise_adaptive_time_stepping(
+              analysis_.at("adaptive_time_stepping")))
+        throw std::runtime_error(
+            "Adaptive time stepping parameters are not defined");
+    }
+
+    // NUMA-aware placement of nodes and particles
+    if (analysis_.find("numa_aware") != analysis_.end() &&
+        analysis_["numa_aware"].template get<bool>()) {
+      mesh_->numa_aware(true);
+#ifdef _OPENMP
+      if (omp_get_proc_bind() == omp_proc_bind_false)
+        console_->warn(
+            "Threads are not pinned for NUMA-aware placement, set "
+            "OMP_PROC_BIND=close and OMP_PLACES=cores");
+#endif
+    }
+
     // Locate particles
     if (analysis_.find("locate_particles") != analysis_.end())
       locate_particles_ = analysis_["locate_particles"].template get<bool>();
@@ -83,6 +103,47 @@ mpm::MPMBase<Tdim>::MPMBase(const std::shared_ptr<IO>& io) : mpm::MPM(io) {
                      __FILE__, __LINE__, exception.what());
     }
 
+    // Quasi-static steps
+    try {
+      if (analysis_.find("quasi_static") != analysis_.end())
+        quasi_static_ =
+            std::make_shared<mpm::QuasiStatic>(analysis_.at("quasi_static"));
+    } catch (std::exception& exception) {
+      console_->error("{} #{}: Quasi-static steps: {}", __FILE__, __LINE__,
+                      exception.what());
+    }
+
+    // Incremental checkpoints
+    try {
+      if (analysis_.find("checkpoint") != analysis_.end()) {
+        const auto& checkpoint = analysis_.at("checkpoint");
+        checkpoint_ = std::make_shared<mpm::Checkpoint>(checkpoint);
+        checkpoint_steps_ = checkpoint.at("steps").template get<mpm::Index>();
+        if (checkpoint_steps_ == 0)
+          throw std::runtime_error("Checkpoint steps should be positive");
+      }
+    } catch (std::exception& exception) {
+      console_->error("{} #{}: Checkpoint: {}", __FILE__, __LINE__,
+                      exception.what());
+      checkpoint_ = nullptr;
+    }
+
+    // Stages of the analysis
+    if (analysis_.find("stages") != analysis_.end()) {
+      for (const auto& stage : analysis_.at("stages"))
+        stages_.emplace_back(stage);
+      // Stage of a resumed analysis
+      if (analysis_.find("resume") != analysis_.end() &&
+          analysis_["resume"].find("stage") != analysis_["resume"].end() &&
+          analysis_["resume"]["resume"].template get<bool>())
+        stage_ = analysis_["resume"]["stage"].template get<unsigned>();
+      if (stage_ >= this->nstages())
+        throw std::runtime_error("Resumed stage is not defined");
+      // Earlier stages run all their steps
+      for (unsigned i = 0; i < stage_; ++i)
+        stage_start_ += stages_[i].at("nsteps").template get<mpm::Index>();
+    }
+
     // Math functions
     try {
       // Get materials properties
@@ -97,6 +158,19 @@ mpm::MPMBase<Tdim>::MPMBase(const std::shared_ptr<IO>& io) : mpm::MPM(io) {
     post_process_ = io_->post_processing();
     // Output steps
     output_steps_ = post_process_["output_steps"].template get<mpm::Index>();
+    // Output interval in simulation time for adaptive time stepping
+    if (post_process_.find("output_interval") != post_process_.end())
+      output_interval_ =
+          post_process_["output_interval"].template get<double>();
+    // Precision of real fields in particle output
+    if (post_process_.find("output_precision") != post_process_.end())
+      single_precision_output_ =
+          (post_process_["output_precision"].template get<std::string>() ==
+           "single");
+    // Profiler of solver phases
+    if (post_process_.find("profiler") != post_process_.end())
+      mpm::Profiler::instance()->enable(
+          post_process_["profiler"].template get<bool>());
 
   } catch (std::domain_error& domain_error) {
     console_->error("{} {} Get analysis object: {}", __FILE__, __LINE__,
@@ -370,21 +444,7 @@ void mpm::MPMBase<Tdim>::initialise_particles() {
   // Material id update using particle sets
   try {
     auto material_sets = io_->json_object("material_sets");
-    if (!material_sets.empty()) {
-      for (const auto& material_set : material_sets) {
-        unsigned material_id =
-            material_set["material_id"].template get<unsigned>();
-        unsigned phase_id = mpm::ParticlePhase::Solid;
-        if (material_set.contains("phase_id"))
-          phase_id = material_set["phase_id"].template get<unsigned>();
-        unsigned pset_id = material_set["pset_id"].template get<unsigned>();
-        // Update material_id for particles in each pset
-        mesh_->iterate_over_particle_set(
-            pset_id, std::bind(&mpm::ParticleBase<Tdim>::assign_material,
-                               std::placeholders::_1,
-                               materials_.at(material_id), phase_id));
-      }
-    }
+    if (!material_sets.empty()) this->assign_material_sets(material_sets);
   } catch (std::exception& exception) {
     console_->warn("{} #{}: Material sets are not specified", __FILE__,
                    __LINE__, exception.what());
@@ -421,6 +481,238 @@ void mpm::MPMBase<Tdim>::initialise_materials() {
   }
   // Copy materials to mesh
   mesh_->initialise_material_models(this->materials_);
+
+  // Wave speeds for adaptive time stepping
+  if (adaptive_time_) this->compute_wave_speeds();
+}
+
+//! Compute elastic wave speeds of materials
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::compute_wave_speeds() {
+  for (const auto& material : materials_) {
+    auto& mat = material.second;
+    double wave_speed = 0.;
+    if (mat->has_property("density")) {
+      const double density = mat->template property<double>("density");
+      // P-wave modulus from Young's modulus and Poisson ratio
+      double modulus = 0.;
+      if (mat->has_property("youngs_modulus") &&
+          mat->has_property("poisson_ratio")) {
+        const double youngs_modulus =
+            mat->template property<double>("youngs_modulus");
+        const double poisson_ratio =
+            mat->template property<double>("poisson_ratio");
+        modulus = youngs_modulus * (1. - poisson_ratio) /
+                  ((1. + poisson_ratio) * (1. - 2. * poisson_ratio));
+      } else if (mat->has_property("bulk_modulus"))
+        modulus = mat->template property<double>("bulk_modulus");
+
+      if (modulus > 0. && density > 0.)
+        wave_speed = std::sqrt(modulus / density);
+    }
+    if (wave_speed == 0.)
+      console_->warn(
+          "Material {} has no elastic wave speed, adaptive time step uses "
+          "particle velocities only",
+          material.first);
+    wave_speeds_[material.first] = wave_speed;
+  }
+}
+
+//! Compute the time step size of the current step
+template <unsigned Tdim>
+double mpm::MPMBase<Tdim>::time_step(unsigned phase) {
+  if (!adaptive_time_) return dt_;
+
+  // Critical time step of particles on this rank
+  double dt_critical = mesh_->critical_time_step(wave_speeds_, phase);
+#ifdef USE_MPI
+  // Minimum critical time step over all ranks
+  MPI_Allreduce(MPI_IN_PLACE, &dt_critical, 1, MPI_DOUBLE, MPI_MIN,
+                MPI_COMM_WORLD);
+#endif
+  // No particles or no moving particles, keep the previous time step
+  if (dt_critical == std::numeric_limits<double>::max()) return dt_;
+  // Scaled inertial mass of quasi-static steps lowers the wave speeds
+  if (quasi_static_) dt_critical *= std::sqrt(quasi_static_->mass_scaling());
+
+  // Safety factor, growth limit and bounds
+  double dt = std::min(courant_number_ * dt_critical, dt_growth_ * dt_);
+  dt = std::max(std::min(dt, dt_max_), dt_min_);
+  return dt;
+}
+
+//! Check if outputs are written in the current step
+template <unsigned Tdim>
+bool mpm::MPMBase<Tdim>::output_step() {
+  if (!adaptive_time_ || output_interval_ <= 0.)
+    return (step_ % output_steps_ == 0);
+
+  if (time_ < next_output_time_) return false;
+  // Next output time past the current time
+  while (next_output_time_ <= time_) next_output_time_ += output_interval_;
+  return true;
+}
+
+//! Check the equilibrium of a quasi-static step
+template <unsigned Tdim>
+bool mpm::MPMBase<Tdim>::quasi_static_converged(unsigned phase) {
+  // Unbalanced and external forces and kinetic energy
+  const auto norms = mesh_->unbalanced_force_norms(phase);
+  std::array<double, 3> values{
+      {norms.first, norms.second, mesh_->kinetic_energy()}};
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, values.data(), values.size(), MPI_DOUBLE,
+                MPI_SUM, MPI_COMM_WORLD);
+#endif
+  // Unbalanced force relative to the external force
+  const double ratio = (values[1] > 0.) ? std::sqrt(values[0] / values[1])
+                                        : std::sqrt(values[0]);
+  quasi_static_->update(time_, values[2], ratio);
+
+  // Kinetic damping resets particle velocities
+  if (quasi_static_->reset_velocities()) {
+    const Eigen::Matrix<double, Tdim, 1> zero =
+        Eigen::Matrix<double, Tdim, 1>::Zero();
+    mesh_->iterate_over_particles(
+        std::bind(&mpm::ParticleBase<Tdim>::assign_velocity,
+                  std::placeholders::_1, zero));
+  }
+
+  return quasi_static_->converged();
+}
+
+//! Initialise a stage of the analysis
+template <unsigned Tdim>
+bool mpm::MPMBase<Tdim>::initialise_stage(unsigned stage,
+                                          mpm::Index start_step) {
+  // Analysis without stages
+  if (stages_.empty()) {
+    stage_end_ = nsteps_;
+    return true;
+  }
+
+  int mpi_rank = 0;
+#ifdef USE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
+
+  bool status = true;
+  try {
+    auto stage_begin = std::chrono::steady_clock::now();
+    const auto& stage_props = stages_.at(stage);
+
+    // Statistics of stress updates are reported per stage
+    this->log_material_statistics(mpi_rank);
+
+    // Steps of the stage from its start
+    const auto nsteps = stage_props.at("nsteps").template get<mpm::Index>();
+    stage_ = stage;
+    stage_start_ = start_step;
+    stage_end_ = std::min(nsteps_, start_step + nsteps);
+
+    // Time step size
+    if (stage_props.find("dt") != stage_props.end())
+      dt_ = stage_props.at("dt").template get<double>();
+
+    // Velocity update
+    if (stage_props.find("velocity_update") != stage_props.end())
+      velocity_update_ =
+          stage_props.at("velocity_update").template get<bool>();
+
+    // Locate particles
+    if (stage_props.find("locate_particles") != stage_props.end())
+      locate_particles_ =
+          stage_props.at("locate_particles").template get<bool>();
+
+    // Damping
+    if (stage_props.find("damping") != stage_props.end()) {
+      if (!initialise_damping(stage_props.at("damping")))
+        throw std::runtime_error("Damping parameters of the stage are invalid");
+    }
+
+    // Quasi-static steps of the stage, otherwise of the analysis
+    quasi_static_ = nullptr;
+    if (stage_props.find("quasi_static") != stage_props.end())
+      quasi_static_ =
+          std::make_shared<mpm::QuasiStatic>(stage_props.at("quasi_static"));
+    else if (analysis_.find("quasi_static") != analysis_.end())
+      quasi_static_ =
+          std::make_shared<mpm::QuasiStatic>(analysis_.at("quasi_static"));
+
+    // Materials are added or replace materials with the same id
+    if (stage_props.find("materials") != stage_props.end()) {
+      for (const auto& material_props : stage_props.at("materials")) {
+        // Get material type
+        const std::string material_type =
+            material_props.at("type").template get<std::string>();
+        // Get material id
+        auto material_id = material_props.at("id").template get<unsigned>();
+        // Create a new material from JSON object
+        auto material =
+            Factory<mpm::Material<Tdim>, unsigned, const Json&>::instance()
+                ->create(material_type, std::move(material_id),
+                         material_props);
+
+        // Particles of a replaced material keep their stresses, mass and
+        // state variables
+        if (materials_.find(material->id()) != materials_.end())
+          mesh_->iterate_over_particles([&material](const auto& particle) {
+            if (particle->material_id() == material->id())
+              particle->replace_material(material);
+          });
+        materials_[material->id()] = material;
+      }
+      // Copy materials to mesh
+      mesh_->initialise_material_models(this->materials_);
+      // Wave speeds for adaptive time stepping
+      if (adaptive_time_) this->compute_wave_speeds();
+    }
+
+    // Materials of particle sets
+    if (stage_props.find("material_sets") != stage_props.end())
+      this->assign_material_sets(stage_props.at("material_sets"));
+
+    // Excavation removes particle sets
+    if (stage_props.find("remove_particle_sets") != stage_props.end()) {
+      for (const auto& pset_id : stage_props.at("remove_particle_sets"))
+        if (!mesh_->remove_particle_set(pset_id.template get<unsigned>()))
+          throw std::runtime_error("Particle set of the stage is not removed");
+    }
+
+    // Boundary conditions replace the current ones
+    if (stage_props.find("boundary_conditions") != stage_props.end()) {
+      mesh_->clear_boundary_conditions();
+      // Create a file reader
+      const std::string io_type =
+          io_->json_object("mesh")["io_type"].template get<std::string>();
+      auto mesh_io = Factory<mpm::IOMesh<Tdim>>::instance()->create(io_type);
+      this->node_euler_angles(stage_props, mesh_io);
+      this->nodal_velocity_constraints(stage_props, mesh_io);
+      this->nodal_frictional_constraints(stage_props, mesh_io);
+      this->particle_velocity_constraints(stage_props, mesh_io);
+    }
+
+    // Loads replace the current ones
+    if (stage_props.find("external_loading_conditions") !=
+        stage_props.end()) {
+      mesh_->clear_loads();
+      set_node_concentrated_force_ = false;
+      this->assign_loads(stage_props.at("external_loading_conditions"));
+    }
+
+    auto stage_end = std::chrono::steady_clock::now();
+    console_->info("Rank {} Stage {} of {} from step {} to {}: {} ms",
+                   mpi_rank, stage, this->nstages(), start_step, stage_end_,
+                   std::chrono::duration_cast<std::chrono::milliseconds>(
+                       stage_end - stage_begin)
+                       .count());
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: Stage {}: {}\n", __FILE__, __LINE__, stage,
+                    exception.what());
+    status = false;
+  }
+  return status;
 }
 
 //! Checkpoint resume
@@ -444,27 +736,86 @@ bool mpm::MPMBase<Tdim>::checkpoint_resume() {
     // Get step
     this->step_ = analysis_["resume"]["step"].template get<mpm::Index>();
 
-    // Input particle h5 file for resume
-    std::string attribute = "particles";
-    std::string extension = ".h5";
-
-    auto particles_file =
-        io_->output_file(attribute, extension, uuid_, step_, this->nsteps_)
+    std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>>
+        unlocatable_particles;
+    if (checkpoint_) {
+      // Reconstruct particles from the full and delta checkpoints
+      const auto checkpoint_file = [this](mpm::Index step) {
+        return io_->output_file("checkpoint", ".h5", uuid_, step, nsteps_)
             .string();
+      };
+      mesh_->initialise_particles_hdf5(
+          mpm::Checkpoint::read(checkpoint_file, step_));
+
+      // Clear all particle ids
+      mesh_->iterate_over_cells(std::bind(
+          &mpm::Cell<Tdim>::clear_particle_ids, std::placeholders::_1));
+
+      // Restore the partition and the particles of cells of the last full
+      // snapshot, particles that moved since are located by a search
+      partition_restored_ = mesh_->read_particles_cells_hdf5(
+          checkpoint_file(mpm::Checkpoint::full_step(checkpoint_file, step_)),
+          &unlocatable_particles);
+      if (!partition_restored_)
+        unlocatable_particles = mesh_->locate_particles_mesh();
+    } else {
+      // Input particle h5 file for resume
+      std::string attribute = "particles";
+      std::string extension = ".h5";
+
+      auto particles_file =
+          io_->output_file(attribute, extension, uuid_, step_, this->nsteps_)
+              .string();
 
-    // Load particle information from file
-    mesh_->read_particles_hdf5(phase, particles_file);
-
-    // Clear all particle ids
-    mesh_->iterate_over_cells(
-        std::bind(&mpm::Cell<Tdim>::clear_particle_ids, std::placeholders::_1));
+      // Particles rounded to single precision cannot restart the analysis
+      if (this->single_precision_hdf5(particles_file))
+        throw std::runtime_error(
+            "Particles are stored in single precision, resume requires "
+            "\"output_precision\": \"double\" or checkpoints");
+
+      // Load particle information from file
+      mesh_->read_particles_hdf5(phase, particles_file);
+
+      // Clear all particle ids
+      mesh_->iterate_over_cells(std::bind(
+          &mpm::Cell<Tdim>::clear_particle_ids, std::placeholders::_1));
+
+      // Restore the partition and the particles of cells of the checkpoint,
+      // otherwise locate particles
+      partition_restored_ = mesh_->read_particles_cells_hdf5(
+          particles_file, &unlocatable_particles);
+      if (!partition_restored_)
+        unlocatable_particles = mesh_->locate_particles_mesh();
+    }
 
-    // Locate particles
-    auto unlocatable_particles = mesh_->locate_particles_mesh();
+#ifdef USE_MPI
+    // Partition is kept only if it is restored on all ranks, so that all
+    // ranks either skip or run the graph partitioning of the mesh
+    int restored = partition_restored_ ? 1 : 0;
+    MPI_Allreduce(MPI_IN_PLACE, &restored, 1, MPI_INT, MPI_LAND,
+                  MPI_COMM_WORLD);
+    partition_restored_ = (restored != 0);
+#endif
 
     if (!unlocatable_particles.empty())
       throw std::runtime_error("Particle outside the mesh domain");
 
+    // State of the solver at the step
+    resume_state_ = this->read_solver_state(
+        checkpoint_ ? io_->output_file("checkpoint", ".h5", uuid_, step_,
+                                       nsteps_)
+                          .string()
+                    : io_->output_file("particles", ".h5", uuid_, step_,
+                                       nsteps_)
+                          .string());
+    // Stage of the step and its start
+    if (resume_state_.find("stage") != resume_state_.end()) {
+      stage_ = resume_state_.at("stage").template get<unsigned>();
+      stage_start_ = resume_state_.at("stage_start").template get<mpm::Index>();
+      if (stage_ >= this->nstages())
+        throw std::runtime_error("Stage of the checkpoint is not defined");
+    }
+
     // Increament step
     ++this->step_;
     console_->info("Checkpoint resume at step {} of {}", this->step_,
@@ -490,7 +841,139 @@ void mpm::MPMBase<Tdim>::write_hdf5(mpm::Index step, mpm::Index max_steps) {
       io_->output_file(attribute, extension, uuid_, step, max_steps).string();
 
   const unsigned phase = 0;
-  mesh_->write_particles_hdf5(phase, particles_file);
+  mesh_->write_particles_hdf5(phase, particles_file, single_precision_output_);
+  // Without checkpoints the particles file in double precision restores the
+  // analysis
+  if (!checkpoint_ && !single_precision_output_) {
+    mesh_->write_particles_cells_hdf5(particles_file);
+    this->write_solver_state(particles_file);
+  }
+}
+
+//! Write the restart checkpoint of the current step
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::write_checkpoint(bool force) {
+  if (!checkpoint_ || (!force && step_ % checkpoint_steps_ != 0)) return;
+
+  const auto checkpoint_file =
+      io_->output_file("checkpoint", ".h5", uuid_, step_, nsteps_).string();
+  // Full snapshots also restore the partition and the particles of cells
+  if (checkpoint_->write(checkpoint_file, step_, mesh_->particles_hdf5()))
+    mesh_->write_particles_cells_hdf5(checkpoint_file);
+  this->write_solver_state(checkpoint_file);
+}
+
+//! Return the state of the solver
+template <unsigned Tdim>
+Json mpm::MPMBase<Tdim>::solver_state() const {
+  Json state;
+  state["time"] = time_;
+  state["dt"] = dt_;
+  state["next_output_time"] = next_output_time_;
+  state["stage"] = stage_;
+  state["stage_start"] = stage_start_;
+  state["stage_end"] = stage_end_;
+  if (quasi_static_) state["quasi_static"] = quasi_static_->state();
+  return state;
+}
+
+//! Restore the state of the solver read by checkpoint resume
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::restore_solver_state() {
+  if (resume_state_.find("time") == resume_state_.end()) {
+    time_ = step_ * dt_;
+    return;
+  }
+  time_ = resume_state_.at("time").template get<double>();
+  dt_ = resume_state_.at("dt").template get<double>();
+  next_output_time_ =
+      resume_state_.at("next_output_time").template get<double>();
+  // End of a stage stopped at equilibrium
+  if (resume_state_.find("stage_end") != resume_state_.end())
+    stage_end_ = resume_state_.at("stage_end").template get<mpm::Index>();
+  if (quasi_static_ &&
+      resume_state_.find("quasi_static") != resume_state_.end())
+    quasi_static_->assign_state(resume_state_.at("quasi_static"));
+}
+
+//! Write the state of the solver as an attribute of an HDF5 file
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::write_solver_state(
+    const std::string& filename) const {
+  hid_t file_id = H5Fopen(filename.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+  if (file_id < 0) {
+    console_->error("{} #{}: HDF5 file {} is not found", __FILE__, __LINE__,
+                    filename);
+    return;
+  }
+  H5LTset_attribute_string(file_id, "/", "solver_state",
+                           this->solver_state().dump().c_str());
+  H5Fclose(file_id);
+}
+
+//! Read the state of the solver from an HDF5 file
+template <unsigned Tdim>
+Json mpm::MPMBase<Tdim>::read_solver_state(const std::string& filename) const {
+  Json state = Json::object();
+  hid_t file_id = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (file_id < 0) return state;
+  if (H5LTfind_attribute(file_id, "solver_state") > 0) {
+    hsize_t dims[1] = {0};
+    H5T_class_t type_class;
+    size_t size = 0;
+    H5LTget_attribute_info(file_id, "/", "solver_state", dims, &type_class,
+                           &size);
+    std::vector<char> buffer(size + 1, '\0');
+    H5LTget_attribute_string(file_id, "/", "solver_state", buffer.data());
+    state = Json::parse(buffer.data());
+  }
+  H5Fclose(file_id);
+  return state;
+}
+
+//! Check if the particle table of an HDF5 file is in single precision
+template <unsigned Tdim>
+bool mpm::MPMBase<Tdim>::single_precision_hdf5(
+    const std::string& filename) const {
+  bool single_precision = false;
+  hid_t file_id = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (file_id < 0) return single_precision;
+  // Tables without a real size are in double precision
+  if (H5Lexists(file_id, "table", H5P_DEFAULT) > 0 &&
+      H5Aexists_by_name(file_id, "table", "real_size", H5P_DEFAULT) > 0) {
+    unsigned real_size = sizeof(double);
+    H5LTget_attribute_uint(file_id, "table", "real_size", &real_size);
+    single_precision = (real_size == sizeof(float));
+  }
+  H5Fclose(file_id);
+  return single_precision;
+}
+
+//! Write the profiler report
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::write_profile() {
+  auto profiler = mpm::Profiler::instance();
+  if (!profiler->enabled()) return;
+  const auto filename =
+      io_->output_file("profile", "", uuid_, step_, nsteps_, false).string();
+  if (!profiler->write(filename))
+    console_->error("Writing profiler report {} failed", filename);
+}
+
+//! Log stress update statistics of materials
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::log_material_statistics(int mpi_rank) {
+  for (const auto& material : materials_) {
+    const auto statistics = material.second->statistics();
+    if (statistics.at("nupdates") == 0) continue;
+    console_->info(
+        "Rank {}, material {}: {} stress updates, {} iterations, {} substeps, "
+        "{} not converged",
+        mpi_rank, material.first, statistics.at("nupdates"),
+        statistics.at("niterations"), statistics.at("nsubsteps"),
+        statistics.at("nnonconverged"));
+    material.second->reset_statistics();
+  }
 }
 
 #ifdef USE_VTK
@@ -666,7 +1149,12 @@ bool mpm::MPMBase<Tdim>::is_isoparametric() {
 //! Initialise loads
 template <unsigned Tdim>
 void mpm::MPMBase<Tdim>::initialise_loads() {
-  auto loads = io_->json_object("external_loading_conditions");
+  this->assign_loads(io_->json_object("external_loading_conditions"));
+}
+
+//! Assign gravity, particle tractions and nodal concentrated forces
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::assign_loads(const Json& loads) {
   // Initialise gravity loading
   if (loads.at("gravity").is_array() &&
       loads.at("gravity").size() == gravity_.size()) {
@@ -684,7 +1172,7 @@ void mpm::MPMBase<Tdim>::initialise_loads() {
 
   // Read and assign particles surface tractions
   if (loads.find("particle_surface_traction") != loads.end()) {
-    for (const auto& ptraction : loads["particle_surface_traction"]) {
+    for (const auto& ptraction : loads.at("particle_surface_traction")) {
       // Get the math function
       std::shared_ptr<FunctionBase> tfunction = nullptr;
       // If a math function is defined set to function or use scalar
@@ -710,7 +1198,7 @@ void mpm::MPMBase<Tdim>::initialise_loads() {
 
   // Read and assign nodal concentrated forces
   if (loads.find("concentrated_nodal_forces") != loads.end()) {
-    for (const auto& nforce : loads["concentrated_nodal_forces"]) {
+    for (const auto& nforce : loads.at("concentrated_nodal_forces")) {
       // Forces are specified in a file
       if (nforce.find("file") != nforce.end()) {
         std::string force_file = nforce.at("file").template get<std::string>();
@@ -1108,6 +1596,40 @@ void mpm::MPMBase<Tdim>::particle_entity_sets(const Json& mesh_props,
   }
 }
 
+// Initialise adaptive time stepping
+template <unsigned Tdim>
+bool mpm::MPMBase<Tdim>::initialise_adaptive_time_stepping(
+    const Json& adaptive_props) {
+
+  // Read adaptive time stepping JSON object
+  bool status = true;
+  try {
+    adaptive_time_ = true;
+    if (adaptive_props.find("courant_number") != adaptive_props.end())
+      courant_number_ =
+          adaptive_props.at("courant_number").template get<double>();
+    if (adaptive_props.find("max_growth") != adaptive_props.end())
+      dt_growth_ = adaptive_props.at("max_growth").template get<double>();
+    if (adaptive_props.find("dt_min") != adaptive_props.end())
+      dt_min_ = adaptive_props.at("dt_min").template get<double>();
+    if (adaptive_props.find("dt_max") != adaptive_props.end())
+      dt_max_ = adaptive_props.at("dt_max").template get<double>();
+    if (adaptive_props.find("final_time") != adaptive_props.end())
+      final_time_ = adaptive_props.at("final_time").template get<double>();
+
+    if (courant_number_ <= 0. || dt_growth_ < 1. || dt_min_ > dt_max_)
+      throw std::runtime_error("Invalid adaptive time stepping parameters");
+
+  } catch (std::exception& exception) {
+    console_->error("#{}: Adaptive time stepping {} ", __LINE__,
+                    exception.what());
+    adaptive_time_ = false;
+    status = false;
+  }
+
+  return status;
+}
+
 // Initialise Damping
 template <unsigned Tdim>
 bool mpm::MPMBase<Tdim>::initialise_damping(const Json& damping_props) {
@@ -1131,9 +1653,28 @@ bool mpm::MPMBase<Tdim>::initialise_damping(const Json& damping_props) {
   return status;
 }
 
+//! Assign materials to particle sets
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::assign_material_sets(const Json& material_sets) {
+  for (const auto& material_set : material_sets) {
+    unsigned material_id =
+        material_set.at("material_id").template get<unsigned>();
+    unsigned phase_id = mpm::ParticlePhase::Solid;
+    if (material_set.contains("phase_id"))
+      phase_id = material_set.at("phase_id").template get<unsigned>();
+    unsigned pset_id = material_set.at("pset_id").template get<unsigned>();
+    // Update material_id for particles in each pset
+    mesh_->iterate_over_particle_set(
+        pset_id, std::bind(&mpm::ParticleBase<Tdim>::assign_material,
+                           std::placeholders::_1, materials_.at(material_id),
+                           phase_id));
+  }
+}
+
 //! Domain decomposition
 template <unsigned Tdim>
 void mpm::MPMBase<Tdim>::mpi_domain_decompose(bool initial_step) {
+  mpm::ScopedTimer timer("domain_decomposition");
 #ifdef USE_MPI
   // Initialise MPI rank and size
   int mpi_rank = 0;
@@ -1158,22 +1699,29 @@ void mpm::MPMBase<Tdim>::mpi_domain_decompose(bool initial_step) {
       throw std::runtime_error("Container of cells is empty");
 
 #ifdef USE_GRAPH_PARTITIONING
-    // Create graph object if empty
-    if (initial_step || graph_ == nullptr)
-      graph_ = std::make_shared<Graph<Tdim>>(mesh_->cells());
-
-    // Find number of particles in each cell across MPI ranks
-    mesh_->find_nglobal_particles_cells();
-
-    // Construct a weighted DAG
-    graph_->construct_graph(mpi_size, mpi_rank);
-
-    // Graph partitioning mode
-    int mode = 4;  // FAST
-    // Create graph partition
-    graph_->create_partitions(&comm, mode);
-    // Collect the partitions
-    auto exchange_cells = graph_->collect_partitions(mpi_size, mpi_rank, &comm);
+    // Cells of particles to transfer to other ranks
+    std::vector<mpm::Index> exchange_cells;
+
+    // Partition restored from a checkpoint is kept
+    if (!partition_restored_) {
+      // Create graph object if empty
+      if (initial_step || graph_ == nullptr)
+        graph_ = std::make_shared<Graph<Tdim>>(mesh_->cells());
+
+      // Find number of particles in each cell across MPI ranks
+      mesh_->find_nglobal_particles_cells();
+
+      // Construct a weighted DAG
+      graph_->construct_graph(mpi_size, mpi_rank);
+
+      // Graph partitioning mode
+      int mode = 4;  // FAST
+      // Create graph partition
+      graph_->create_partitions(&comm, mode);
+      // Collect the partitions
+      exchange_cells = graph_->collect_partitions(mpi_size, mpi_rank, &comm);
+    }
+    partition_restored_ = false;
 
     // Identify shared nodes across MPI domains
     mesh_->find_domain_shared_nodes();
@@ -22,10 +22,6 @@ class MPMExplicit : public MPMBase<Tdim> {
   //! Solve
   bool solve() override;
 
-  //! Compute stress strain
-  //! \param[in] phase Phase to smooth pressure
-  void compute_stress_strain(unsigned phase);
-
  protected:
   // Generate a unique id for the analysis
   using mpm::MPMBase<Tdim>::uuid_;
@@ -33,6 +29,8 @@ class MPMExplicit : public MPMBase<Tdim> {
   using mpm::MPMBase<Tdim>::dt_;
   //! Current step
   using mpm::MPMBase<Tdim>::step_;
+  //! Current time
+  using mpm::MPMBase<Tdim>::time_;
   //! Number of steps
   using mpm::MPMBase<Tdim>::nsteps_;
   //! Number of steps
@@ -73,8 +71,20 @@ class MPMExplicit : public MPMBase<Tdim> {
   using mpm::MPMBase<Tdim>::damping_type_;
   //! Damping factor
   using mpm::MPMBase<Tdim>::damping_factor_;
+  //! Quasi-static steps
+  using mpm::MPMBase<Tdim>::quasi_static_;
+  //! Current stage
+  using mpm::MPMBase<Tdim>::stage_;
+  //! Step at which the current stage starts
+  using mpm::MPMBase<Tdim>::stage_start_;
+  //! Step at which the current stage ends
+  using mpm::MPMBase<Tdim>::stage_end_;
   //! Locate particles
   using mpm::MPMBase<Tdim>::locate_particles_;
+  //! Adaptive time stepping
+  using mpm::MPMBase<Tdim>::adaptive_time_;
+  //! Final time of adaptive time stepping
+  using mpm::MPMBase<Tdim>::final_time_;
 
  private:
   //! Pressure smoothing
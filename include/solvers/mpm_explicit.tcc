@@ -17,25 +17,6 @@ mpm::MPMExplicit<Tdim>::MPMExplicit(const std::shared_ptr<IO>& io)
     contact_ = std::make_shared<mpm::Contact<Tdim>>(mesh_);
 }
 
-//! MPM Explicit compute stress strain
-template <unsigned Tdim>
-void mpm::MPMExplicit<Tdim>::compute_stress_strain(unsigned phase) {
-  // Iterate over each particle to calculate strain
-  mesh_->iterate_over_particles(std::bind(
-      &mpm::ParticleBase<Tdim>::compute_strain, std::placeholders::_1, dt_));
-
-  // Iterate over each particle to update particle volume
-  mesh_->iterate_over_particles(std::bind(
-      &mpm::ParticleBase<Tdim>::update_volume, std::placeholders::_1));
-
-  // Pressure smoothing
-  if (pressure_smoothing_) this->pressure_smoothing(phase);
-
-  // Iterate over each particle to compute stress
-  mesh_->iterate_over_particles(std::bind(
-      &mpm::ParticleBase<Tdim>::compute_stress, std::placeholders::_1));
-}
-
 //! MPM Explicit solver
 template <unsigned Tdim>
 bool mpm::MPMExplicit<Tdim>::solve() {
@@ -95,8 +76,20 @@ bool mpm::MPMExplicit<Tdim>::solve() {
   this->mpi_domain_decompose(initial_step);
 
   auto solver_begin = std::chrono::steady_clock::now();
+  // First stage, the whole analysis without stages
+  status = this->initialise_stage(stage_, stage_start_);
+  // Time of a resumed or a new analysis
+  this->restore_solver_state();
+
   // Main loop
-  for (; step_ < nsteps_; ++step_) {
+  for (; status && step_ < nsteps_ && time_ < final_time_; ++step_) {
+    // Next stages start where the previous stage ends and reuse the mesh,
+    // its partition and the particles
+    while (status && step_ >= stage_end_ && stage_ + 1 < this->nstages())
+      status = this->initialise_stage(stage_ + 1, stage_end_);
+    if (!status || step_ >= stage_end_) break;
+
+    mpm::ScopedTimer step_timer("step");
 
     if (mpi_rank == 0) console_->info("Step: {} of {}.\n", step_, nsteps_);
 
@@ -108,20 +101,26 @@ bool mpm::MPMExplicit<Tdim>::solve() {
 #endif
 #endif
 
+    // Time step size
+    dt_ = this->time_step(phase);
+    mpm_scheme_->assign_time(dt_, time_);
+    if (adaptive_time_ && mpi_rank == 0)
+      console_->info("Time: {}, dt: {}.\n", time_, dt_);
+
     // Inject particles
-    mesh_->inject_particles(step_ * dt_);
+    mesh_->inject_particles(time_);
 
     // Initialise nodes, cells and shape functions
     mpm_scheme_->initialise();
 
     // Initialise nodal properties and append material ids to node
-    contact_->initialise();
+    if (interface_) contact_->initialise();
 
     // Mass momentum and compute velocity at nodes
     mpm_scheme_->compute_nodal_kinematics(phase);
 
     // Map material properties to nodes
-    contact_->compute_contact_forces();
+    if (interface_) contact_->compute_contact_forces();
 
     // Update stress first
     mpm_scheme_->precompute_stress_strain(phase, pressure_smoothing_);
@@ -130,9 +129,14 @@ bool mpm::MPMExplicit<Tdim>::solve() {
     mpm_scheme_->compute_forces(gravity_, phase, step_,
                                 set_node_concentrated_force_);
 
-    // Particle kinematics
-    mpm_scheme_->compute_particle_kinematics(velocity_update_, phase, "Cundall",
-                                             damping_factor_);
+    // Particle kinematics, quasi-static steps with dynamic relaxation
+    if (quasi_static_)
+      mpm_scheme_->compute_particle_kinematics(
+          velocity_update_, phase, "Viscous",
+          quasi_static_->damping_coefficient(), quasi_static_->mass_scaling());
+    else
+      mpm_scheme_->compute_particle_kinematics(velocity_update_, phase,
+                                               "Cundall", damping_factor_);
 
     // Update Stress Last
     mpm_scheme_->postcompute_stress_strain(phase, pressure_smoothing_);
@@ -147,7 +151,26 @@ bool mpm::MPMExplicit<Tdim>::solve() {
 #endif
 #endif
 
-    if (step_ % output_steps_ == 0) {
+    // Advance time
+    time_ += dt_;
+
+    // Equilibrium of quasi-static steps ends the stage
+    const bool equilibrium = quasi_static_ &&
+                             this->quasi_static_converged(phase) &&
+                             quasi_static_->terminate();
+    // The stage ends with the step, whose output and checkpoint resume the
+    // next stage
+    if (equilibrium) {
+      if (mpi_rank == 0)
+        console_->info("Quasi-static equilibrium at step {}, ratio: {}",
+                       step_, quasi_static_->unbalanced_ratio());
+      stage_end_ = step_ + 1;
+    }
+
+    if (this->output_step() || equilibrium) {
+      mpm::ScopedTimer output_timer("output");
+      // Material stress update statistics
+      this->log_material_statistics(mpi_rank);
       // HDF5 outputs
       this->write_hdf5(this->step_, this->nsteps_);
 #ifdef USE_VTK
@@ -159,6 +182,9 @@ bool mpm::MPMExplicit<Tdim>::solve() {
       this->write_partio(this->step_, this->nsteps_);
 #endif
     }
+
+    // Restart checkpoint, at equilibrium to resume the next stage
+    this->write_checkpoint(equilibrium);
   }
   auto solver_end = std::chrono::steady_clock::now();
   console_->info("Rank {}, Explicit {} solver duration: {} ms", mpi_rank,
@@ -167,5 +193,8 @@ bool mpm::MPMExplicit<Tdim>::solve() {
                      solver_end - solver_begin)
                      .count());
 
+  // Profiler report of solver phases
+  this->write_profile();
+
   return status;
 }
@@ -0,0 +1,185 @@
+#ifndef MPM_MPM_IMPLICIT_H_
+#define MPM_MPM_IMPLICIT_H_
+
+#ifdef USE_GRAPH_PARTITIONING
+#include "graph.h"
+#endif
+
+#include "bicgstab.h"
+#include "mpm_base.h"
+
+namespace mpm {
+
+//! MPMImplicit class
+//! \brief A class that implements the implicit one phase mpm
+//! \details A single-phase MPM with Newmark time integration, which is not
+//! limited by the critical time step of explicit integration. Nodal velocities
+//! at the end of a step are solved with Newton iterations, in which the
+//! Jacobian of the nodal residual is applied matrix free by finite differences
+//! of the residual, and the Newton updates are solved with BiCGSTAB. The
+//! residual is scaled by the lumped nodal mass, which preconditions the
+//! system as a Jacobi preconditioner of the mass matrix.
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+class MPMImplicit : public MPMBase<Tdim> {
+ public:
+  //! Default constructor
+  MPMImplicit(const std::shared_ptr<IO>& io);
+
+  //! Solve
+  bool solve() override;
+
+  //! Mass scaled residual of nodal velocities at the end of the step
+  //! \param[in] velocity Nodal velocities at the end of the step
+  //! \param[in] phase Phase of the nodes
+  Eigen::VectorXd residual(const Eigen::VectorXd& velocity, unsigned phase);
+
+  //! Finite difference Jacobian of the residual in a direction
+  //! \param[in] velocity Nodal velocities of the linearisation
+  //! \param[in] residual Residual of the nodal velocities
+  //! \param[in] direction Direction of the nodal velocities
+  //! \param[in] phase Phase of the nodes
+  Eigen::VectorXd jacobian(const Eigen::VectorXd& velocity,
+                           const Eigen::VectorXd& residual,
+                           const Eigen::VectorXd& direction, unsigned phase);
+
+  //! Return the nodal velocities at the end of the last solved step
+  const Eigen::VectorXd& solution() const { return solution_; }
+
+ protected:
+  // Generate a unique id for the analysis
+  using mpm::MPMBase<Tdim>::uuid_;
+  //! Time step size
+  using mpm::MPMBase<Tdim>::dt_;
+  //! Current step
+  using mpm::MPMBase<Tdim>::step_;
+  //! Current time
+  using mpm::MPMBase<Tdim>::time_;
+  //! Number of steps
+  using mpm::MPMBase<Tdim>::nsteps_;
+  //! Number of steps
+  using mpm::MPMBase<Tdim>::nload_balance_steps_;
+  //! Output steps
+  using mpm::MPMBase<Tdim>::output_steps_;
+  //! A unique ptr to IO object
+  using mpm::MPMBase<Tdim>::io_;
+  //! JSON analysis object
+  using mpm::MPMBase<Tdim>::analysis_;
+  //! JSON post-process object
+  using mpm::MPMBase<Tdim>::post_process_;
+  //! Logger
+  using mpm::MPMBase<Tdim>::console_;
+  //! MPM Scheme
+  using mpm::MPMBase<Tdim>::mpm_scheme_;
+
+#ifdef USE_GRAPH_PARTITIONING
+  //! Graph
+  using mpm::MPMBase<Tdim>::graph_;
+#endif
+
+  //! Gravity
+  using mpm::MPMBase<Tdim>::gravity_;
+  //! Mesh object
+  using mpm::MPMBase<Tdim>::mesh_;
+  //! Materials
+  using mpm::MPMBase<Tdim>::materials_;
+  //! Node concentrated force
+  using mpm::MPMBase<Tdim>::set_node_concentrated_force_;
+  //! Locate particles
+  using mpm::MPMBase<Tdim>::locate_particles_;
+  //! Final time of adaptive time stepping
+  using mpm::MPMBase<Tdim>::final_time_;
+  //! Current stage
+  using mpm::MPMBase<Tdim>::stage_;
+  //! Step at which the current stage starts
+  using mpm::MPMBase<Tdim>::stage_start_;
+  //! Step at which the current stage ends
+  using mpm::MPMBase<Tdim>::stage_end_;
+
+ private:
+  //! Initialise Newmark and nonlinear solver parameters
+  //! \param[in] analysis JSON analysis object
+  void initialise_implicit(const Json& analysis);
+
+  //! Collect nodes with mass and their kinematics at the start of the step
+  //! \param[in] phase Phase of the nodes
+  void initialise_dofs(unsigned phase);
+
+  //! Inner product of nodal vectors reduced over MPI ranks
+  //! \details Nodes shared by MPI ranks are weighted by the number of ranks
+  //! \param[in] a Nodal vector
+  //! \param[in] b Nodal vector
+  double dot(const Eigen::VectorXd& a, const Eigen::VectorXd& b) const;
+
+  //! Assign velocities to nodes with velocity constraints applied
+  //! \param[in] velocity Nodal velocities
+  //! \param[in] phase Phase of the nodes
+  //! \retval constrained Constrained nodal velocities
+  Eigen::VectorXd constrain(const Eigen::VectorXd& velocity, unsigned phase);
+
+  //! Nodal acceleration at the end of the step
+  //! \param[in] velocity Nodal velocities at the end of the step
+  Eigen::VectorXd acceleration(const Eigen::VectorXd& velocity) const;
+
+  //! Nodal displacement increment of the step
+  //! \param[in] acceleration Nodal acceleration at the end of the step
+  Eigen::VectorXd displacement(const Eigen::VectorXd& acceleration) const;
+
+  //! Nodal internal force of trial stresses of a displacement increment
+  //! \param[in] displacement Nodal displacement increment
+  //! \param[in] phase Phase of the nodes
+  Eigen::VectorXd internal_force(const Eigen::VectorXd& displacement,
+                                 unsigned phase);
+
+  //! Assign nodal and particle accelerations in equilibrium with the forces
+  //! at the start of the step
+  //! \param[in] phase Phase of the nodes
+  void initialise_acceleration(unsigned phase);
+
+  //! Solve nodal velocities at the end of the step with Newton iterations
+  //! \param[in] phase Phase of the nodes
+  //! \retval status Newton iterations have converged
+  bool solve_step(unsigned phase);
+
+  //! Update stresses and particles from the solved nodal velocities
+  //! \param[in] phase Phase of the nodes
+  void update_particles(unsigned phase);
+
+  //! Pressure smoothing
+  bool pressure_smoothing_{false};
+  //! Newmark beta parameter
+  double beta_{0.25};
+  //! Newmark gamma parameter
+  double gamma_{0.5};
+  //! Maximum number of Newton iterations
+  unsigned max_iterations_{20};
+  //! Tolerance of the residual norm relative to the initial residual
+  double tolerance_{1.E-6};
+  //! Absolute tolerance of the residual norm
+  double absolute_tolerance_{1.E-12};
+  //! Maximum number of BiCGSTAB iterations
+  unsigned krylov_max_iterations_{200};
+  //! Tolerance of BiCGSTAB relative to the Newton residual
+  double krylov_tolerance_{1.E-3};
+  //! Nodes with mass
+  std::vector<std::shared_ptr<mpm::NodeBase<Tdim>>> dof_nodes_;
+  //! Inner product weights of the degrees of freedom
+  Eigen::VectorXd weights_;
+  //! Nodal mass of the degrees of freedom
+  Eigen::VectorXd mass_;
+  //! Nodal velocity at the start of the step
+  Eigen::VectorXd velocity_;
+  //! Nodal acceleration at the start of the step
+  Eigen::VectorXd acceleration_;
+  //! Nodal external force of the step
+  Eigen::VectorXd external_force_;
+  //! Constrained velocities of zero nodal velocities
+  Eigen::VectorXd constrained_zero_;
+  //! Nodal velocities at the end of the step
+  Eigen::VectorXd solution_;
+};  // MPMImplicit class
+}  // namespace mpm
+
+#include "mpm_implicit.tcc"
+
+#endif  // MPM_MPM_IMPLICIT_H_
@@ -0,0 +1,458 @@
+//! Constructor
+template <unsigned Tdim>
+mpm::MPMImplicit<Tdim>::MPMImplicit(const std::shared_ptr<IO>& io)
+    : mpm::MPMBase<Tdim>(io) {
+  //! Logger
+  console_ = spdlog::get("MPMImplicit");
+  //! Stress is updated after the nodal velocities are solved
+  mpm_scheme_ = std::make_shared<mpm::MPMSchemeUSF<Tdim>>(mesh_, dt_);
+
+  // Newmark and nonlinear solver parameters
+  try {
+    this->initialise_implicit(analysis_);
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+  }
+}
+
+//! Initialise Newmark and nonlinear solver parameters
+template <unsigned Tdim>
+void mpm::MPMImplicit<Tdim>::initialise_implicit(const Json& analysis) {
+  // Newmark parameters, average acceleration by default
+  if (analysis.find("newmark") != analysis.end()) {
+    const auto& newmark = analysis.at("newmark");
+    if (newmark.find("beta") != newmark.end())
+      beta_ = newmark.at("beta").template get<double>();
+    if (newmark.find("gamma") != newmark.end())
+      gamma_ = newmark.at("gamma").template get<double>();
+  }
+  if (beta_ <= 0. || gamma_ <= 0.)
+    throw std::runtime_error("Newmark beta and gamma should be positive");
+
+  // Newton and BiCGSTAB iterations
+  if (analysis.find("nonlinear_solver") != analysis.end()) {
+    const auto& solver = analysis.at("nonlinear_solver");
+    if (solver.find("max_iterations") != solver.end())
+      max_iterations_ = solver.at("max_iterations").template get<unsigned>();
+    if (solver.find("tolerance") != solver.end())
+      tolerance_ = solver.at("tolerance").template get<double>();
+    if (solver.find("absolute_tolerance") != solver.end())
+      absolute_tolerance_ =
+          solver.at("absolute_tolerance").template get<double>();
+    if (solver.find("krylov_max_iterations") != solver.end())
+      krylov_max_iterations_ =
+          solver.at("krylov_max_iterations").template get<unsigned>();
+    if (solver.find("krylov_tolerance") != solver.end())
+      krylov_tolerance_ = solver.at("krylov_tolerance").template get<double>();
+  }
+}
+
+//! Collect nodes with mass and their kinematics at the start of the step
+template <unsigned Tdim>
+void mpm::MPMImplicit<Tdim>::initialise_dofs(unsigned phase) {
+  const double tolerance = 1.E-16;
+  const auto& nodes = mesh_->nodes(-1);
+  dof_nodes_.clear();
+  for (auto nitr = nodes.cbegin(); nitr != nodes.cend(); ++nitr)
+    if ((*nitr)->mass(phase) > tolerance) dof_nodes_.emplace_back(*nitr);
+
+  const Eigen::Index ndofs = dof_nodes_.size() * Tdim;
+  weights_.resize(ndofs);
+  mass_.resize(ndofs);
+  velocity_.resize(ndofs);
+  acceleration_.resize(ndofs);
+  external_force_.resize(ndofs);
+
+  mpm::parallel_for(dof_nodes_.cbegin(), dof_nodes_.cend(), [&](auto nitr) {
+    const auto& node = *nitr;
+    const Eigen::Index offset = (nitr - dof_nodes_.cbegin()) * Tdim;
+    // Nodes shared by MPI ranks count once in inner products
+    const double weight =
+        1. / std::max<std::size_t>(1, node->mpi_ranks().size());
+    const double mass = node->mass(phase);
+    // Velocity and mass weighted acceleration with velocity constraints
+    node->compute_velocity();
+    weights_.segment<Tdim>(offset).setConstant(weight);
+    mass_.segment<Tdim>(offset).setConstant(mass);
+    velocity_.segment<Tdim>(offset) = node->velocity(phase);
+    acceleration_.segment<Tdim>(offset) = node->acceleration(phase) / mass;
+    external_force_.segment<Tdim>(offset) = node->external_force(phase);
+  });
+
+  constrained_zero_ = this->constrain(Eigen::VectorXd::Zero(ndofs), phase);
+}
+
+//! Inner product of nodal vectors reduced over MPI ranks
+template <unsigned Tdim>
+double mpm::MPMImplicit<Tdim>::dot(const Eigen::VectorXd& a,
+                                   const Eigen::VectorXd& b) const {
+  double product = (weights_.array() * a.array() * b.array()).sum();
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &product, 1, MPI_DOUBLE, MPI_SUM,
+                MPI_COMM_WORLD);
+#endif
+  return product;
+}
+
+//! Assign velocities to nodes with velocity constraints applied
+template <unsigned Tdim>
+Eigen::VectorXd mpm::MPMImplicit<Tdim>::constrain(
+    const Eigen::VectorXd& velocity, unsigned phase) {
+  Eigen::VectorXd constrained(velocity.size());
+  mpm::parallel_for(dof_nodes_.cbegin(), dof_nodes_.cend(), [&](auto nitr) {
+    const auto& node = *nitr;
+    const Eigen::Index offset = (nitr - dof_nodes_.cbegin()) * Tdim;
+    const Eigen::Matrix<double, Tdim, 1> momentum =
+        node->mass(phase) * velocity.segment<Tdim>(offset);
+    node->update_momentum(false, phase, momentum);
+    node->compute_velocity();
+    constrained.segment<Tdim>(offset) = node->velocity(phase);
+  });
+  return constrained;
+}
+
+//! Nodal acceleration at the end of the step
+template <unsigned Tdim>
+Eigen::VectorXd mpm::MPMImplicit<Tdim>::acceleration(
+    const Eigen::VectorXd& velocity) const {
+  return (velocity - velocity_) / (gamma_ * dt_) -
+         ((1. - gamma_) / gamma_) * acceleration_;
+}
+
+//! Nodal displacement increment of the step
+template <unsigned Tdim>
+Eigen::VectorXd mpm::MPMImplicit<Tdim>::displacement(
+    const Eigen::VectorXd& acceleration) const {
+  return dt_ * velocity_ +
+         (dt_ * dt_) * ((0.5 - beta_) * acceleration_ + beta_ * acceleration);
+}
+
+//! Nodal internal force of trial stresses of a displacement increment
+template <unsigned Tdim>
+Eigen::VectorXd mpm::MPMImplicit<Tdim>::internal_force(
+    const Eigen::VectorXd& displacement, unsigned phase) {
+  // Nodal velocity of the displacement increment
+  this->constrain(displacement / dt_, phase);
+  for (const auto& node : dof_nodes_)
+    node->update_internal_force(false, phase,
+                                Eigen::Matrix<double, Tdim, 1>::Zero());
+
+  // Map internal force of trial stresses
+  mesh_->iterate_over_particles(
+      std::bind(&mpm::ParticleBase<Tdim>::map_trial_internal_force,
+                std::placeholders::_1, dt_));
+
+#ifdef USE_MPI
+  int mpi_size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  // MPI all reduce internal force
+  if (mpi_size > 1)
+    mesh_->template nodal_halo_exchange<Eigen::Matrix<double, Tdim, 1>, Tdim>(
+        std::bind(&mpm::NodeBase<Tdim>::internal_force, std::placeholders::_1,
+                  phase),
+        std::bind(&mpm::NodeBase<Tdim>::update_internal_force,
+                  std::placeholders::_1, false, phase, std::placeholders::_2));
+#endif
+
+  Eigen::VectorXd force(displacement.size());
+  for (unsigned i = 0; i < dof_nodes_.size(); ++i)
+    force.segment<Tdim>(i * Tdim) = dof_nodes_[i]->internal_force(phase);
+  return force;
+}
+
+//! Mass scaled residual of nodal velocities at the end of the step
+template <unsigned Tdim>
+Eigen::VectorXd mpm::MPMImplicit<Tdim>::residual(
+    const Eigen::VectorXd& velocity, unsigned phase) {
+  // Constrained velocities and the kinematics of the step
+  const Eigen::VectorXd constrained = this->constrain(velocity, phase);
+  const Eigen::VectorXd acceleration = this->acceleration(constrained);
+  const Eigen::VectorXd force =
+      this->internal_force(this->displacement(acceleration), phase);
+
+  // Out of balance force is scaled by the diagonal of the Jacobian of the
+  // inertia, and constrained directions are replaced by the constraint
+  const Eigen::VectorXd scaled =
+      (mass_.cwiseProduct(acceleration) - external_force_ - force)
+          .cwiseQuotient(mass_) *
+      (gamma_ * dt_);
+  return this->constrain(scaled, phase) - constrained_zero_ + velocity -
+         constrained;
+}
+
+//! Finite difference Jacobian of the residual in a direction
+template <unsigned Tdim>
+Eigen::VectorXd mpm::MPMImplicit<Tdim>::jacobian(
+    const Eigen::VectorXd& velocity, const Eigen::VectorXd& residual,
+    const Eigen::VectorXd& direction, unsigned phase) {
+  const double direction_norm = std::sqrt(this->dot(direction, direction));
+  if (direction_norm == 0.) return Eigen::VectorXd::Zero(direction.size());
+  const double epsilon = std::sqrt(std::numeric_limits<double>::epsilon()) *
+                         (1. + std::sqrt(this->dot(velocity, velocity))) /
+                         direction_norm;
+  return (this->residual(velocity + epsilon * direction, phase) - residual) /
+         epsilon;
+}
+
+//! Assign nodal and particle accelerations in equilibrium with the forces at
+//! the start of the step
+template <unsigned Tdim>
+void mpm::MPMImplicit<Tdim>::initialise_acceleration(unsigned phase) {
+  // Internal force of the stresses at the start of the step
+  const Eigen::VectorXd force =
+      this->internal_force(Eigen::VectorXd::Zero(mass_.size()), phase);
+  // Constrained directions have no acceleration
+  acceleration_ =
+      this->constrain((external_force_ + force).cwiseQuotient(mass_), phase) -
+      constrained_zero_;
+
+  for (unsigned i = 0; i < dof_nodes_.size(); ++i)
+    dof_nodes_[i]->update_acceleration(false, phase,
+                                       acceleration_.segment<Tdim>(i * Tdim));
+  mesh_->iterate_over_particles(
+      std::bind(&mpm::ParticleBase<Tdim>::interpolate_acceleration,
+                std::placeholders::_1));
+}
+
+//! Solve nodal velocities at the end of the step with Newton iterations
+template <unsigned Tdim>
+bool mpm::MPMImplicit<Tdim>::solve_step(unsigned phase) {
+  // Explicit predictor of the nodal velocities
+  solution_ = velocity_ + dt_ * acceleration_;
+
+  Eigen::VectorXd residual = this->residual(solution_, phase);
+  const double norm0 = std::sqrt(this->dot(residual, residual));
+  double norm = norm0;
+
+  const auto dot = [this](const Eigen::VectorXd& a, const Eigen::VectorXd& b) {
+    return this->dot(a, b);
+  };
+
+  unsigned iteration = 0;
+  for (; iteration < max_iterations_; ++iteration) {
+    if (norm <= tolerance_ * norm0 || norm <= absolute_tolerance_) break;
+
+    // Jacobian of the residual at the current solution
+    const auto jacobian = [&](const Eigen::VectorXd& direction) {
+      return this->jacobian(solution_, residual, direction, phase);
+    };
+
+    // Newton update
+    Eigen::VectorXd update = Eigen::VectorXd::Zero(solution_.size());
+    unsigned krylov_iterations = 0;
+    if (!mpm::bicgstab(jacobian, dot, -residual, &update,
+                       krylov_max_iterations_, krylov_tolerance_,
+                       &krylov_iterations))
+      console_->warn("BiCGSTAB has not converged in {} iterations",
+                     krylov_iterations);
+    solution_ += update;
+
+    residual = this->residual(solution_, phase);
+    norm = std::sqrt(this->dot(residual, residual));
+    console_->debug("Newton iteration: {}, BiCGSTAB iterations: {}, "
+                    "residual: {}",
+                    iteration, krylov_iterations, norm);
+  }
+  return (norm <= tolerance_ * norm0 || norm <= absolute_tolerance_);
+}
+
+//! Update stresses and particles from the solved nodal velocities
+template <unsigned Tdim>
+void mpm::MPMImplicit<Tdim>::update_particles(unsigned phase) {
+  const Eigen::VectorXd velocity = this->constrain(solution_, phase);
+  const Eigen::VectorXd acceleration = this->acceleration(velocity);
+
+  // Nodal velocity of the displacement increment and end of step acceleration
+  this->constrain(this->displacement(acceleration) / dt_, phase);
+  for (unsigned i = 0; i < dof_nodes_.size(); ++i)
+    dof_nodes_[i]->update_acceleration(false, phase,
+                                       acceleration.segment<Tdim>(i * Tdim));
+
+  // Commit strains and stresses of the displacement increment
+  mpm_scheme_->compute_stress_strain(phase, pressure_smoothing_);
+
+  // Iterate over each particle to compute updated position
+  mesh_->iterate_over_particles(
+      std::bind(&mpm::ParticleBase<Tdim>::compute_updated_position_newmark,
+                std::placeholders::_1, dt_, gamma_));
+
+  // Apply particle velocity constraints
+  mesh_->apply_particle_velocity_constraints();
+}
+
+//! MPM Implicit solver
+template <unsigned Tdim>
+bool mpm::MPMImplicit<Tdim>::solve() {
+  bool status = true;
+
+  console_->info("MPM analysis type {}", io_->analysis_type());
+
+  // Initialise MPI rank and size
+  int mpi_rank = 0;
+  int mpi_size = 1;
+
+#ifdef USE_MPI
+  // Get MPI rank
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+  // Get number of MPI ranks
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+#endif
+
+  // Phase
+  const unsigned phase = 0;
+
+  // Accelerations are not stored by particles of a new or a resumed analysis
+  bool initialise_acceleration = true;
+
+  // Test if checkpoint resume is needed
+  bool resume = false;
+  if (analysis_.find("resume") != analysis_.end())
+    resume = analysis_["resume"]["resume"].template get<bool>();
+
+  // Pressure smoothing
+  pressure_smoothing_ = io_->analysis_bool("pressure_smoothing");
+
+  // Initialise material
+  this->initialise_materials();
+
+  // Initialise mesh
+  this->initialise_mesh();
+
+  // Initialise particles
+  this->initialise_particles();
+
+  // Initialise loading conditions
+  this->initialise_loads();
+
+  // Compute mass
+  mesh_->iterate_over_particles(
+      std::bind(&mpm::ParticleBase<Tdim>::compute_mass, std::placeholders::_1));
+
+  // Check point resume
+  if (resume) this->checkpoint_resume();
+
+  // Domain decompose
+  bool initial_step = (resume == true) ? false : true;
+  this->mpi_domain_decompose(initial_step);
+
+  auto solver_begin = std::chrono::steady_clock::now();
+  // First stage, the whole analysis without stages
+  status = this->initialise_stage(stage_, stage_start_);
+  // Time of a resumed or a new analysis
+  this->restore_solver_state();
+
+  // Main loop
+  for (; status && step_ < nsteps_ && time_ < final_time_; ++step_) {
+    // Next stages start where the previous stage ends and reuse the mesh,
+    // its partition and the particles
+    while (status && step_ >= stage_end_ && stage_ + 1 < this->nstages())
+      status = this->initialise_stage(stage_ + 1, stage_end_);
+    if (!status || step_ >= stage_end_) break;
+
+    mpm::ScopedTimer step_timer("step");
+
+    if (mpi_rank == 0) console_->info("Step: {} of {}.\n", step_, nsteps_);
+
+#ifdef USE_MPI
+#ifdef USE_GRAPH_PARTITIONING
+    // Run load balancer at a specified frequency
+    if (step_ % nload_balance_steps_ == 0 && step_ != 0)
+      this->mpi_domain_decompose(false);
+#endif
+#endif
+
+    mpm_scheme_->assign_time(dt_, time_);
+
+    // Inject particles
+    mesh_->inject_particles(time_);
+
+    // Initialise nodes, cells and shape functions
+    mpm_scheme_->initialise();
+
+    // Mass momentum and compute velocity at nodes
+    mpm_scheme_->compute_nodal_kinematics(phase);
+
+    // Map mass weighted acceleration to nodes
+    mesh_->iterate_over_particles(
+        std::bind(&mpm::ParticleBase<Tdim>::map_acceleration_to_nodes,
+                  std::placeholders::_1));
+#ifdef USE_MPI
+    // MPI all reduce nodal acceleration
+    if (mpi_size > 1)
+      mesh_->template nodal_halo_exchange<Eigen::Matrix<double, Tdim, 1>,
+                                          Tdim>(
+          std::bind(&mpm::NodeBase<Tdim>::acceleration, std::placeholders::_1,
+                    phase),
+          std::bind(&mpm::NodeBase<Tdim>::update_acceleration,
+                    std::placeholders::_1, false, phase,
+                    std::placeholders::_2));
+#endif
+
+    // Compute external forces of the step, the internal force is computed
+    // from the trial stresses of the Newton iterations
+    mpm_scheme_->compute_forces(gravity_, phase, step_,
+                                set_node_concentrated_force_, false);
+
+    // Solve nodal velocities at the end of the step
+    {
+      mpm::ScopedTimer newton_timer("newton");
+      this->initialise_dofs(phase);
+      if (initialise_acceleration) {
+        this->initialise_acceleration(phase);
+        initialise_acceleration = false;
+      }
+      if (!this->solve_step(phase)) {
+        if (mpi_rank == 0)
+          console_->error("Newton iterations have not converged in step {}",
+                          step_);
+        status = false;
+        break;
+      }
+    }
+
+    // Update stresses and particles
+    this->update_particles(phase);
+
+    // Locate particles
+    mpm_scheme_->locate_particles(this->locate_particles_);
+
+#ifdef USE_MPI
+#ifdef USE_GRAPH_PARTITIONING
+    mesh_->transfer_halo_particles();
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+#endif
+
+    // Advance time
+    time_ += dt_;
+
+    if (this->output_step()) {
+      mpm::ScopedTimer output_timer("output");
+      // Material stress update statistics
+      this->log_material_statistics(mpi_rank);
+      // HDF5 outputs
+      this->write_hdf5(this->step_, this->nsteps_);
+#ifdef USE_VTK
+      // VTK outputs
+      this->write_vtk(this->step_, this->nsteps_);
+#endif
+#ifdef USE_PARTIO
+      // Partio outputs
+      this->write_partio(this->step_, this->nsteps_);
+#endif
+    }
+
+    // Restart checkpoint
+    this->write_checkpoint();
+  }
+  auto solver_end = std::chrono::steady_clock::now();
+  console_->info("Rank {}, Implicit solver duration: {} ms", mpi_rank,
+                 std::chrono::duration_cast<std::chrono::milliseconds>(
+                     solver_end - solver_begin)
+                     .count());
+
+  // Profiler report of solver phases
+  this->write_profile();
+
+  return status;
+}
@@ -53,18 +53,24 @@ class MPMScheme {
   //! \param[in] step Number of step in solver
   //! \param[in] concentrated_nodal_forces Boolean for if a concentrated force
   //! is applied or not
+  //! \param[in] internal_force Map the internal force of particle stresses,
+  //! which is not required by solvers that compute their own internal force
   virtual inline void compute_forces(
       const Eigen::Matrix<double, Tdim, 1>& gravity, unsigned phase,
-      unsigned step, bool concentrated_nodal_forces);
+      unsigned step, bool concentrated_nodal_forces,
+      bool internal_force = true);
 
   //! Compute acceleration velocity position
   //! \param[in] velocity_update Velocity or acceleration update flag
   //! \param[in] phase Phase of particle
-  //! \param[in] damping_type Type of damping
-  //! \param[in] damping_factor Value of critical damping
+  //! \param[in] damping_type Type of damping, Cundall, Viscous or None
+  //! \param[in] damping_factor Value of critical damping, or the mass
+  //! proportional damping coefficient of viscous damping
+  //! \param[in] mass_scaling Scaling factor of the inertial mass of viscous
+  //! damping
   virtual inline void compute_particle_kinematics(
       bool velocity_update, unsigned phase, const std::string& damping_type,
-      double damping_factor);
+      double damping_factor, double mass_scaling = 1.);
 
   //! Compute particle location
   //! \param[in] locate_particles Flag to enable locate particles, if set to
@@ -75,11 +81,24 @@ class MPMScheme {
   //! \retval scheme Stress update scheme
   virtual inline std::string scheme() const = 0;
 
+  //! Assign the time step size and the time at the start of the step
+  //! \param[in] dt Time step size
+  //! \param[in] current_time Time at the start of the step
+  void assign_time(double dt, double current_time) {
+    dt_ = dt;
+    current_time_ = current_time;
+    time_assigned_ = true;
+  }
+
  protected:
   //! Mesh object
   std::shared_ptr<mpm::Mesh<Tdim>> mesh_;
   //! Time increment
   double dt_;
+  //! Time at the start of the step
+  double current_time_{0.};
+  //! Current time is assigned, otherwise it is step * dt
+  bool time_assigned_{false};
   //! MPI Size
   int mpi_size_ = 1;
   //! MPI rank
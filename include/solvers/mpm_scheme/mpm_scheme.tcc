@@ -17,31 +17,29 @@ mpm::MPMScheme<Tdim>::MPMScheme(const std::shared_ptr<mpm::Mesh<Tdim>>& mesh,
 //! Initialize nodes, cells and shape functions
 template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::initialise() {
-#pragma omp parallel sections
+  mpm::ScopedTimer timer("initialise");
+  // Update the step plan after topology changes
+  mesh_->update_step_plan();
+
+  // Step graph: nodes and particles are independent branches, and the loops
+  // of each branch are split into tasks of a single team. In NUMA-aware mode
+  // the branches run in turn with loops of the static first-touch partition
+#pragma omp parallel if (!mesh_->numa_aware())
+#pragma omp single
   {
-    // Spawn a task for initialising nodes and cells
-#pragma omp section
-    {
-      // Initialise nodes
-      mesh_->iterate_over_nodes(
-          std::bind(&mpm::NodeBase<Tdim>::initialise, std::placeholders::_1));
-
-      mesh_->iterate_over_cells(
-          std::bind(&mpm::Cell<Tdim>::activate_nodes, std::placeholders::_1));
-    }
-    // Spawn a task for particles
-#pragma omp section
-    {
-      // Iterate over each particle to compute shapefn
-      mesh_->iterate_over_particles(std::bind(
-          &mpm::ParticleBase<Tdim>::compute_shapefn, std::placeholders::_1));
-    }
-  }  // Wait to complete
+    // Initialise nodes of the previous step and activate nodes
+#pragma omp task
+    mesh_->initialise_step_nodes();
+
+    // Compute shapefn of particles in the shape function cache
+    mesh_->compute_shapefn();
+  }  // Wait for the step graph to complete
 }
 
 //! Compute nodal kinematics - map mass and momentum to nodes
 template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::compute_nodal_kinematics(unsigned phase) {
+  mpm::ScopedTimer timer("p2g");
   // Assign mass and momentum to nodes
   mesh_->iterate_over_particles(
       std::bind(&mpm::ParticleBase<Tdim>::map_mass_momentum_to_nodes,
@@ -73,10 +71,10 @@ inline void mpm::MPMScheme<Tdim>::compute_nodal_kinematics(unsigned phase) {
 template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::compute_stress_strain(
     unsigned phase, bool pressure_smoothing) {
+  mpm::ScopedTimer timer("stress");
 
-  // Iterate over each particle to calculate strain
-  mesh_->iterate_over_particles(std::bind(
-      &mpm::ParticleBase<Tdim>::compute_strain, std::placeholders::_1, dt_));
+  // Compute strain of particles, sharing centroid strain rates of cells
+  mesh_->compute_particle_strains(dt_);
 
   // Iterate over each particle to update particle volume
   mesh_->iterate_over_particles(std::bind(
@@ -85,9 +83,8 @@ inline void mpm::MPMScheme<Tdim>::compute_stress_strain(
   // Pressure smoothing
   if (pressure_smoothing) this->pressure_smoothing(phase);
 
-  // Iterate over each particle to compute stress
-  mesh_->iterate_over_particles(std::bind(
-      &mpm::ParticleBase<Tdim>::compute_stress, std::placeholders::_1));
+  // Compute stress of particles in batches sharing a material
+  mesh_->compute_particle_stresses(mpm::ParticlePhase::Solid);
 }
 
 //! Pressure smoothing
@@ -118,36 +115,39 @@ inline void mpm::MPMScheme<Tdim>::pressure_smoothing(unsigned phase) {
 template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::compute_forces(
     const Eigen::Matrix<double, Tdim, 1>& gravity, unsigned phase,
-    unsigned step, bool concentrated_nodal_forces) {
-  // Spawn a task for external force
-#pragma omp parallel sections
+    unsigned step, bool concentrated_nodal_forces, bool internal_force) {
+  mpm::ScopedTimer timer("forces");
+  // Time at the start of the step
+  const double current_time = time_assigned_ ? current_time_ : step * dt_;
+  // Update the step plan before its tasks read it
+  mesh_->update_step_plan();
+
+  // Step graph: body force, tractions, concentrated forces and internal
+  // force are independent, as nodal forces are updated under the node lock
+#pragma omp parallel if (!mesh_->numa_aware())
+#pragma omp single
   {
-#pragma omp section
-    {
-      // Iterate over each particle to compute nodal body force
-      mesh_->iterate_over_particles(
-          std::bind(&mpm::ParticleBase<Tdim>::map_body_force,
-                    std::placeholders::_1, gravity));
-
-      // Apply particle traction and map to nodes
-      mesh_->apply_traction_on_particles(step * dt_);
-
-      // Iterate over each node to add concentrated node force to external
-      // force
-      if (concentrated_nodal_forces)
-        mesh_->iterate_over_nodes(
-            std::bind(&mpm::NodeBase<Tdim>::apply_concentrated_force,
-                      std::placeholders::_1, phase, (step * dt_)));
+    // Iterate over each particle to compute nodal body force
+#pragma omp task
+    mesh_->iterate_over_particles(
+        std::bind(&mpm::ParticleBase<Tdim>::map_body_force,
+                  std::placeholders::_1, gravity));
+
+    // Apply particle traction and map to nodes
+#pragma omp task
+    mesh_->apply_traction_on_particles(current_time);
+
+    // Iterate over each node to add concentrated node force to external force
+    if (concentrated_nodal_forces) {
+#pragma omp task
+      mesh_->apply_nodal_concentrated_forces(phase, current_time);
     }
 
-#pragma omp section
-    {
-      // Spawn a task for internal force
-      // Iterate over each particle to compute nodal internal force
+    // Iterate over each particle to compute nodal internal force
+    if (internal_force)
       mesh_->iterate_over_particles(std::bind(
           &mpm::ParticleBase<Tdim>::map_internal_force, std::placeholders::_1));
-    }
-  }  // Wait for tasks to finish
+  }  // Wait for the step graph to complete
 
 #ifdef USE_MPI
   // Run if there is more than a single MPI task
@@ -159,11 +159,14 @@ inline void mpm::MPMScheme<Tdim>::compute_forces(
         std::bind(&mpm::NodeBase<Tdim>::update_external_force,
                   std::placeholders::_1, false, phase, std::placeholders::_2));
     // MPI all reduce internal force
-    mesh_->template nodal_halo_exchange<Eigen::Matrix<double, Tdim, 1>, Tdim>(
-        std::bind(&mpm::NodeBase<Tdim>::internal_force, std::placeholders::_1,
-                  phase),
-        std::bind(&mpm::NodeBase<Tdim>::update_internal_force,
-                  std::placeholders::_1, false, phase, std::placeholders::_2));
+    if (internal_force)
+      mesh_->template nodal_halo_exchange<Eigen::Matrix<double, Tdim, 1>,
+                                          Tdim>(
+          std::bind(&mpm::NodeBase<Tdim>::internal_force,
+                    std::placeholders::_1, phase),
+          std::bind(&mpm::NodeBase<Tdim>::update_internal_force,
+                    std::placeholders::_1, false, phase,
+                    std::placeholders::_2));
   }
 #endif
 }
@@ -172,7 +175,8 @@ inline void mpm::MPMScheme<Tdim>::compute_forces(
 template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::compute_particle_kinematics(
     bool velocity_update, unsigned phase, const std::string& damping_type,
-    double damping_factor) {
+    double damping_factor, double mass_scaling) {
+  mpm::ScopedTimer timer("g2p");
 
   // Check if damping has been specified and accordingly Iterate over
   // active nodes to compute acceleratation and velocity
@@ -181,6 +185,12 @@ inline void mpm::MPMScheme<Tdim>::compute_particle_kinematics(
         std::bind(&mpm::NodeBase<Tdim>::compute_acceleration_velocity_cundall,
                   std::placeholders::_1, phase, dt_, damping_factor),
         std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
+  else if (damping_type == "Viscous")
+    mesh_->iterate_over_nodes_predicate(
+        std::bind(&mpm::NodeBase<Tdim>::compute_acceleration_velocity_viscous,
+                  std::placeholders::_1, phase, dt_, damping_factor,
+                  mass_scaling),
+        std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
   else
     mesh_->iterate_over_nodes_predicate(
         std::bind(&mpm::NodeBase<Tdim>::compute_acceleration_velocity,
@@ -199,6 +209,7 @@ inline void mpm::MPMScheme<Tdim>::compute_particle_kinematics(
 // Locate particles
 template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::locate_particles(bool locate_particles) {
+  mpm::ScopedTimer timer("locate");
 
   auto unlocatable_particles = mesh_->locate_particles_mesh();
 
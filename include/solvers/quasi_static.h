@@ -0,0 +1,104 @@
+#ifndef MPM_QUASI_STATIC_H_
+#define MPM_QUASI_STATIC_H_
+
+#include <limits>
+#include <string>
+
+#include "json.hpp"
+
+using Json = nlohmann::json;
+
+namespace mpm {
+
+//! Damping of quasi-static steps
+//! Kinetic: Particle velocities are reset at peaks of the kinetic energy
+//! Viscous: Mass proportional damping adapted to the lowest frequency
+enum class QuasiStaticDamping { Kinetic, Viscous };
+
+// QuasiStatic class
+//! \brief Dynamic relaxation of explicit steps to a static equilibrium
+//! \details The state at the end of each step updates the damping and the
+//! convergence of the run. Kinetic damping resets particle velocities when
+//! the kinetic energy has passed a peak. Viscous damping estimates the lowest
+//! frequency from the time between peaks of the kinetic energy, which are
+//! half a period apart, and applies a fraction of its critical damping.
+//! Steps converge when the norm of the unbalanced force relative to the norm
+//! of the external force is below the tolerance.
+class QuasiStatic {
+ public:
+  //! Constructor with quasi-static properties
+  //! \param[in] props Damping type "kinetic" or "viscous", damping ratio of
+  //! viscous damping, mass scaling factor, tolerance of the unbalanced force
+  //! ratio, minimum number of steps and if the run stops when converged
+  explicit QuasiStatic(const Json& props);
+
+  //! Update with the state at the end of a step
+  //! \param[in] time Time at the end of the step
+  //! \param[in] kinetic_energy Kinetic energy of all particles
+  //! \param[in] unbalanced_ratio Unbalanced over external force norm
+  void update(double time, double kinetic_energy, double unbalanced_ratio);
+
+  //! Return the state of the damping and convergence to resume from
+  Json state() const;
+
+  //! Assign the state of the damping and convergence of a resumed run
+  //! \param[in] state State of the damping and convergence
+  void assign_state(const Json& state);
+
+  //! Return the damping type
+  QuasiStaticDamping damping() const { return damping_; }
+
+  //! Return the mass proportional damping coefficient of the next step
+  double damping_coefficient() const { return damping_coefficient_; }
+
+  //! Return the scaling factor of the inertial mass
+  double mass_scaling() const { return mass_scaling_; }
+
+  //! Return if particle velocities are reset after the step
+  bool reset_velocities() const { return reset_velocities_; }
+
+  //! Return the unbalanced force ratio of the last step
+  double unbalanced_ratio() const { return unbalanced_ratio_; }
+
+  //! Return if the steps have converged to equilibrium
+  bool converged() const { return converged_; }
+
+  //! Return if the run stops at equilibrium
+  bool terminate() const { return terminate_; }
+
+ private:
+  //! Damping type
+  QuasiStaticDamping damping_{QuasiStaticDamping::Kinetic};
+  //! Fraction of critical damping of viscous damping
+  double damping_ratio_{1.};
+  //! Scaling factor of the inertial mass
+  double mass_scaling_{1.};
+  //! Tolerance of the unbalanced force ratio
+  double tolerance_{1.E-4};
+  //! Minimum number of steps before convergence
+  unsigned min_steps_{10};
+  //! Stop the run at equilibrium
+  bool terminate_{true};
+  //! Number of steps
+  unsigned nsteps_{0};
+  //! Kinetic energy of the previous step
+  double kinetic_energy_{0.};
+  //! Time of the previous step
+  double time_{0.};
+  //! Kinetic energy has increased in the previous step
+  bool rising_{false};
+  //! Time of the last peak of the kinetic energy, negative without a peak
+  double peak_time_{-1.};
+  //! Mass proportional damping coefficient
+  double damping_coefficient_{0.};
+  //! Reset particle velocities
+  bool reset_velocities_{false};
+  //! Unbalanced force ratio of the last step
+  double unbalanced_ratio_{std::numeric_limits<double>::max()};
+  //! Steps have converged
+  bool converged_{false};
+};  // QuasiStatic class
+
+}  // namespace mpm
+
+#endif  // MPM_QUASI_STATIC_H_
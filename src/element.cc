@@ -1,7 +1,9 @@
 #include "element.h"
 #include "factory.h"
+#include "hexahedron_bspline_element.h"
 #include "hexahedron_element.h"
 #include "hexahedron_gimp_element.h"
+#include "quadrilateral_bspline_element.h"
 #include "quadrilateral_element.h"
 #include "quadrilateral_gimp_element.h"
 #include "triangle_element.h"
@@ -28,6 +30,14 @@ static Register<mpm::Element<2>, mpm::QuadrilateralElement<2, 9>> quad9(
 static Register<mpm::Element<2>, mpm::QuadrilateralGIMPElement<2, 16>>
     quad_gimp16("ED2Q16G");
 
+// Quadrilateral 16-noded quadratic B-spline element
+static Register<mpm::Element<2>, mpm::QuadrilateralBSplineElement<2, 16, 2>>
+    quad_bspline2("ED2Q16B2");
+
+// Quadrilateral 16-noded cubic B-spline element
+static Register<mpm::Element<2>, mpm::QuadrilateralBSplineElement<2, 16, 3>>
+    quad_bspline3("ED2Q16B3");
+
 // Hexahedron 8-noded element
 static Register<mpm::Element<3>, mpm::HexahedronElement<3, 8>> hex8("ED3H8");
 
@@ -37,3 +47,11 @@ static Register<mpm::Element<3>, mpm::HexahedronElement<3, 20>> hex20("ED3H20");
 // Quadrilateral 4-node-base GIMP element
 static Register<mpm::Element<3>, mpm::HexahedronGIMPElement<3, 64>> hex_gimp64(
     "ED3H64G");
+
+// Hexahedron 64-noded quadratic B-spline element
+static Register<mpm::Element<3>, mpm::HexahedronBSplineElement<3, 64, 2>>
+    hex_bspline2("ED3H64B2");
+
+// Hexahedron 64-noded cubic B-spline element
+static Register<mpm::Element<3>, mpm::HexahedronBSplineElement<3, 64, 3>>
+    hex_bspline3("ED3H64B3");
@@ -1,4 +1,8 @@
 #include "hdf5_particle.h"
+
+#include <cstring>
+#include <stdexcept>
+
 namespace mpm {
 namespace hdf5 {
 namespace particle {
@@ -189,6 +193,82 @@ const hid_t field_type[NFIELDS] = {
     H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
     H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
     H5T_NATIVE_DOUBLE};
+
+//! Constructor with dimension and number of state variables
+CompactLayout::CompactLayout(unsigned dim, unsigned nstate_vars,
+                             bool single_precision) {
+  if (dim < 1 || dim > 3)
+    throw std::runtime_error("Invalid dimension of particle table");
+  if (nstate_vars > NSTATE_VARS)
+    throw std::runtime_error("# of state variables cannot be more than 20");
+
+  // Number of stress and strain components in Voigt notation
+  const unsigned ntensor = (dim == 1) ? 1 : ((dim == 2) ? 4 : 6);
+
+  // Id, mass, volume and pressure
+  for (unsigned i = 0; i < 4; ++i) fields_.emplace_back(i);
+  // Coordinates, displacement, natural size and velocity
+  for (unsigned vec = 0; vec < 4; ++vec)
+    for (unsigned i = 0; i < dim; ++i) fields_.emplace_back(4 + vec * 3 + i);
+  // Stresses and strains
+  for (unsigned tensor = 0; tensor < 2; ++tensor)
+    for (unsigned i = 0; i < ntensor; ++i)
+      fields_.emplace_back(16 + tensor * 6 + i);
+  // Volumetric strain, status, cell id, material id and nstate_vars
+  for (unsigned i = 28; i < 33; ++i) fields_.emplace_back(i);
+  // State variables
+  for (unsigned i = 0; i < nstate_vars; ++i) fields_.emplace_back(33 + i);
+
+  offsets_.reserve(fields_.size());
+  sizes_.reserve(fields_.size());
+  names_.reserve(fields_.size());
+  types_.reserve(fields_.size());
+  narrowed_.reserve(fields_.size());
+  if (single_precision) real_size_ = sizeof(float);
+  for (const auto field : fields_) {
+    // Real fields are narrowed to float in single precision
+    const bool narrowed =
+        single_precision && (field_type[field] == H5T_NATIVE_DOUBLE);
+    const size_t size = narrowed ? sizeof(float) : dst_sizes[field];
+    offsets_.emplace_back(record_size_);
+    sizes_.emplace_back(size);
+    names_.emplace_back(mpm::hdf5::particle::field_names[field]);
+    types_.emplace_back(narrowed ? H5T_NATIVE_FLOAT : field_type[field]);
+    narrowed_.emplace_back(narrowed);
+    record_size_ += size;
+  }
+}
+
+//! Pack particle data in a record
+void CompactLayout::pack(const HDF5Particle& particle, char* record) const {
+  const char* data = reinterpret_cast<const char*>(&particle);
+  for (unsigned i = 0; i < fields_.size(); ++i) {
+    if (narrowed_[i]) {
+      double value;
+      std::memcpy(&value, data + dst_offset[fields_[i]], sizeof(double));
+      const float narrow = static_cast<float>(value);
+      std::memcpy(record + offsets_[i], &narrow, sizeof(float));
+    } else
+      std::memcpy(record + offsets_[i], data + dst_offset[fields_[i]],
+                  sizes_[i]);
+  }
+}
+
+//! Unpack a record to particle data
+void CompactLayout::unpack(const char* record, HDF5Particle* particle) const {
+  char* data = reinterpret_cast<char*>(particle);
+  for (unsigned i = 0; i < fields_.size(); ++i) {
+    if (narrowed_[i]) {
+      float narrow;
+      std::memcpy(&narrow, record + offsets_[i], sizeof(float));
+      const double value = narrow;
+      std::memcpy(data + dst_offset[fields_[i]], &value, sizeof(double));
+    } else
+      std::memcpy(data + dst_offset[fields_[i]], record + offsets_[i],
+                  sizes_[i]);
+  }
+}
+
 }  // namespace particle
 }  // namespace hdf5
 }  // namespace mpm
@@ -0,0 +1,426 @@
+#include "checkpoint.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+
+//! Group of contiguous real fields of the particle table
+struct FieldGroup {
+  //! Name of the dataset
+  const char* name;
+  //! Name of the first field in the particle table
+  const char* field;
+  //! Number of fields
+  unsigned nfields;
+  //! Fields are only used for output
+  bool output;
+};
+
+//! Real fields of particles grouped as they change together
+const FieldGroup field_groups[] = {
+    {"mass", "mass", 1, false},
+    {"volume", "volume", 1, false},
+    {"pressure", "pressure", 1, true},
+    {"coordinates", "coord_x", 3, false},
+    {"displacements", "displacement_x", 3, true},
+    {"nsize", "nsize_x", 3, false},
+    {"velocities", "velocity_x", 3, false},
+    {"stresses", "stress_xx", 6, false},
+    {"strains", "strain_xx", 6, true},
+    {"epsilon_v", "epsilon_v", 1, true},
+    {"svars", "svars_0", mpm::hdf5::particle::NSTATE_VARS, false}};
+const unsigned NGROUPS = sizeof(field_groups) / sizeof(FieldGroup);
+
+// Fields of a group are consecutive doubles of a particle
+static_assert(offsetof(mpm::HDF5Particle, coord_z) ==
+                  offsetof(mpm::HDF5Particle, coord_x) + 2 * sizeof(double),
+              "Coordinates of HDF5 particles are not contiguous");
+static_assert(offsetof(mpm::HDF5Particle, displacement_z) ==
+                  offsetof(mpm::HDF5Particle, displacement_x) +
+                      2 * sizeof(double),
+              "Displacements of HDF5 particles are not contiguous");
+static_assert(offsetof(mpm::HDF5Particle, nsize_z) ==
+                  offsetof(mpm::HDF5Particle, nsize_x) + 2 * sizeof(double),
+              "Natural sizes of HDF5 particles are not contiguous");
+static_assert(offsetof(mpm::HDF5Particle, velocity_z) ==
+                  offsetof(mpm::HDF5Particle, velocity_x) +
+                      2 * sizeof(double),
+              "Velocities of HDF5 particles are not contiguous");
+static_assert(offsetof(mpm::HDF5Particle, tau_xz) ==
+                  offsetof(mpm::HDF5Particle, stress_xx) + 5 * sizeof(double),
+              "Stresses of HDF5 particles are not contiguous");
+static_assert(offsetof(mpm::HDF5Particle, gamma_xz) ==
+                  offsetof(mpm::HDF5Particle, strain_xx) + 5 * sizeof(double),
+              "Strains of HDF5 particles are not contiguous");
+static_assert(sizeof(mpm::HDF5Particle::svars) ==
+                  mpm::hdf5::particle::NSTATE_VARS * sizeof(double),
+              "State variables of HDF5 particles do not match NSTATE_VARS");
+
+//! Return the index in the particle table of the first field of each group
+//! \details Fields of a group are consecutive real fields of the table
+const std::vector<unsigned>& group_fields() {
+  static const std::vector<unsigned> indices = [] {
+    using namespace mpm::hdf5::particle;
+    std::vector<unsigned> indices;
+    for (const auto& group : field_groups) {
+      unsigned first = 0;
+      while (first < NFIELDS && std::strcmp(field_names[first], group.field))
+        ++first;
+      if (first + group.nfields > NFIELDS)
+        throw std::runtime_error(std::string("HDF5 particle field ") +
+                                 group.field + " is not found");
+      for (unsigned j = 0; j < group.nfields; ++j)
+        if (dst_sizes[first + j] != sizeof(double) ||
+            dst_offset[first + j] != dst_offset[first] + j * sizeof(double))
+          throw std::runtime_error(std::string("HDF5 particle fields of ") +
+                                   group.name + " are not contiguous reals");
+      indices.emplace_back(first);
+    }
+    return indices;
+  }();
+  return indices;
+}
+
+//! Number of integer fields of a particle: status, cell id, material id
+//! and number of state variables
+const unsigned NSTATE_FIELDS = 4;
+
+//! Return a real field of a particle
+inline double& field(mpm::HDF5Particle& particle, unsigned index) {
+  return *reinterpret_cast<double*>(reinterpret_cast<char*>(&particle) +
+                                    mpm::hdf5::particle::dst_offset[index]);
+}
+
+//! Return a real field of a particle
+inline double field(const mpm::HDF5Particle& particle, unsigned index) {
+  return *reinterpret_cast<const double*>(
+      reinterpret_cast<const char*>(&particle) +
+      mpm::hdf5::particle::dst_offset[index]);
+}
+
+//! Return the integer fields of a particle
+inline void state(const mpm::HDF5Particle& particle,
+                  unsigned long long* values) {
+  values[0] = particle.status;
+  values[1] = particle.cell_id;
+  values[2] = particle.material_id;
+  values[3] = particle.nstate_vars;
+}
+
+//! Assign the integer fields of a particle
+inline void assign_state(const unsigned long long* values,
+                         mpm::HDF5Particle* particle) {
+  particle->status = (values[0] != 0);
+  particle->cell_id = values[1];
+  particle->material_id = static_cast<unsigned>(values[2]);
+  particle->nstate_vars = static_cast<unsigned>(values[3]);
+}
+
+//! Write the changed values and their indices as datasets
+//! \details Nothing is written if no particle changed and the indices are
+//! omitted if all particles changed
+template <typename Tvalue>
+void write_changes(hid_t file_id, const std::string& name, hid_t type,
+                   unsigned width, size_t nparticles,
+                   const std::vector<unsigned long long>& indices,
+                   const std::vector<Tvalue>& values) {
+  if (indices.empty()) return;
+  const hsize_t dims[2] = {indices.size(), width};
+  H5LTmake_dataset(file_id, name.c_str(), 2, dims, type, values.data());
+  if (indices.size() != nparticles) {
+    const hsize_t index_dims[1] = {indices.size()};
+    H5LTmake_dataset(file_id, (name + "_index").c_str(), 1, index_dims,
+                     H5T_NATIVE_ULLONG, indices.data());
+  }
+}
+
+//! Read the changed values and their indices
+//! \retval status Dataset of changed values exists
+template <typename Tvalue>
+bool read_changes(hid_t file_id, const std::string& name, hid_t type,
+                  unsigned width, size_t nparticles,
+                  std::vector<unsigned long long>* indices,
+                  std::vector<Tvalue>* values) {
+  if (H5LTfind_dataset(file_id, name.c_str()) <= 0) return false;
+  hsize_t dims[2] = {0, 0};
+  H5LTget_dataset_info(file_id, name.c_str(), dims, nullptr, nullptr);
+  if (dims[1] != width)
+    throw std::runtime_error("Checkpoint dataset " + name +
+                             " has incorrect width");
+  values->resize(dims[0] * width);
+  H5LTread_dataset(file_id, name.c_str(), type, values->data());
+
+  const std::string index_name = name + "_index";
+  indices->resize(dims[0]);
+  if (H5LTfind_dataset(file_id, index_name.c_str()) > 0) {
+    hsize_t index_dims[1] = {0};
+    H5LTget_dataset_info(file_id, index_name.c_str(), index_dims, nullptr,
+                         nullptr);
+    if (index_dims[0] != dims[0])
+      throw std::runtime_error("Checkpoint dataset " + index_name +
+                               " has incorrect size");
+    H5LTread_dataset(file_id, index_name.c_str(), H5T_NATIVE_ULLONG,
+                     indices->data());
+  } else {
+    if (dims[0] != nparticles)
+      throw std::runtime_error("Checkpoint dataset " + name +
+                               " has incorrect size");
+    for (size_t i = 0; i < indices->size(); ++i) (*indices)[i] = i;
+  }
+  for (const auto index : *indices)
+    if (index >= nparticles)
+      throw std::runtime_error("Checkpoint dataset " + index_name +
+                               " has an invalid index");
+  return true;
+}
+
+}  // namespace
+
+//! Constructor with checkpoint properties
+mpm::Checkpoint::Checkpoint(const Json& props) {
+  if (props.find("full_interval") != props.end())
+    full_interval_ = props.at("full_interval").template get<unsigned>();
+  if (props.find("tolerance") != props.end())
+    tolerance_ = props.at("tolerance").template get<double>();
+
+  if (full_interval_ == 0)
+    throw std::runtime_error("Checkpoint full interval should be positive");
+  if (tolerance_ < 0.)
+    throw std::runtime_error("Checkpoint tolerance should not be negative");
+}
+
+//! Write the checkpoint of a step
+bool mpm::Checkpoint::write(const std::string& filename, mpm::Index step,
+                            const std::vector<HDF5Particle>& particles) {
+  const bool full = !written_ || (ndeltas_ + 1 >= full_interval_);
+  const size_t nparticles = particles.size();
+  const size_t absent = std::numeric_limits<size_t>::max();
+
+  // Index of each particle in the previous checkpoint
+  std::vector<size_t> previous(nparticles, absent);
+  bool same_ids = !full && (nparticles == reference_.size());
+  if (!full) {
+    std::unordered_map<mpm::Index, size_t> reference_index;
+    reference_index.reserve(reference_.size());
+    for (size_t i = 0; i < reference_.size(); ++i)
+      reference_index.emplace(reference_[i].id, i);
+    for (size_t i = 0; i < nparticles; ++i) {
+      const auto itr = reference_index.find(particles[i].id);
+      if (itr != reference_index.end()) previous[i] = itr->second;
+      same_ids = same_ids && (previous[i] == i);
+    }
+  }
+
+  // Reconstructed particles start from the previous checkpoint, new particles
+  // have all their fields written
+  std::vector<HDF5Particle> reference(nparticles);
+  for (size_t i = 0; i < nparticles; ++i) {
+    if (previous[i] != absent) {
+      reference[i] = reference_[previous[i]];
+    } else {
+      reference[i] = HDF5Particle();
+      reference[i].id = particles[i].id;
+    }
+  }
+
+  hid_t file_id =
+      H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+  if (file_id < 0)
+    throw std::runtime_error("Checkpoint file " + filename +
+                             " cannot be created");
+
+  const int full_flag = full ? 1 : 0;
+  const long long steps[3] = {static_cast<long long>(step),
+                              static_cast<long long>(previous_step_),
+                              static_cast<long long>(nparticles)};
+  H5LTset_attribute_int(file_id, "/", "full", &full_flag, 1);
+  H5LTset_attribute_long_long(file_id, "/", "step", &steps[0], 1);
+  H5LTset_attribute_long_long(file_id, "/", "previous_step", &steps[1], 1);
+  H5LTset_attribute_long_long(file_id, "/", "nparticles", &steps[2], 1);
+
+  // Ids of particles when particles are added, removed or reordered
+  if (!same_ids && nparticles > 0) {
+    std::vector<unsigned long long> ids(nparticles);
+    for (size_t i = 0; i < nparticles; ++i) ids[i] = particles[i].id;
+    const hsize_t dims[1] = {nparticles};
+    H5LTmake_dataset(file_id, "ids", 1, dims, H5T_NATIVE_ULLONG, ids.data());
+  }
+
+  // Real fields of particles whose fields changed
+  const auto& first_fields = group_fields();
+  for (unsigned g = 0; g < NGROUPS; ++g) {
+    const auto& group = field_groups[g];
+    const unsigned first = first_fields[g];
+    const double tolerance = group.output ? tolerance_ : 0.;
+    std::vector<unsigned long long> indices;
+    std::vector<double> values;
+    for (size_t i = 0; i < nparticles; ++i) {
+      bool changed = (previous[i] == absent);
+      for (unsigned j = 0; j < group.nfields && !changed; ++j) {
+        const double value = field(particles[i], first + j);
+        const double stored = field(reference[i], first + j);
+        changed = group.output ? !(std::fabs(value - stored) <= tolerance)
+                               : !(value == stored);
+      }
+      if (!changed) continue;
+      indices.emplace_back(i);
+      for (unsigned j = 0; j < group.nfields; ++j) {
+        const double value = field(particles[i], first + j);
+        field(reference[i], first + j) = value;
+        values.emplace_back(value);
+      }
+    }
+    write_changes(file_id, group.name, H5T_NATIVE_DOUBLE, group.nfields,
+                  nparticles, indices, values);
+  }
+
+  // Integer fields of particles whose fields changed
+  {
+    std::vector<unsigned long long> indices;
+    std::vector<unsigned long long> values;
+    unsigned long long value[NSTATE_FIELDS], stored[NSTATE_FIELDS];
+    for (size_t i = 0; i < nparticles; ++i) {
+      state(particles[i], value);
+      state(reference[i], stored);
+      bool changed = (previous[i] == absent);
+      for (unsigned j = 0; j < NSTATE_FIELDS; ++j)
+        changed = changed || (value[j] != stored[j]);
+      if (!changed) continue;
+      indices.emplace_back(i);
+      assign_state(value, &reference[i]);
+      values.insert(values.end(), value, value + NSTATE_FIELDS);
+    }
+    write_changes(file_id, "state", H5T_NATIVE_ULLONG, NSTATE_FIELDS,
+                  nparticles, indices, values);
+  }
+
+  H5Fclose(file_id);
+
+  reference_ = std::move(reference);
+  previous_step_ = step;
+  ndeltas_ = full ? 0 : ndeltas_ + 1;
+  written_ = true;
+  return full;
+}
+
+//! Return the steps of the checkpoints from a step to its full snapshot
+std::vector<mpm::Index> mpm::Checkpoint::snapshot_steps(
+    const std::function<std::string(mpm::Index)>& filename,
+    mpm::Index step) {
+  std::vector<mpm::Index> steps;
+  int full = 0;
+  while (!full) {
+    const std::string file = filename(step);
+    hid_t file_id = H5Fopen(file.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (file_id < 0)
+      throw std::runtime_error("Checkpoint file " + file + " is not found");
+    long long previous_step = 0;
+    H5LTget_attribute_int(file_id, "/", "full", &full);
+    H5LTget_attribute_long_long(file_id, "/", "previous_step", &previous_step);
+    H5Fclose(file_id);
+
+    steps.emplace_back(step);
+    if (!full && (previous_step < 0 ||
+                  static_cast<mpm::Index>(previous_step) >= step))
+      throw std::runtime_error("Checkpoint " + file +
+                               " has an invalid previous step");
+    step = static_cast<mpm::Index>(previous_step);
+  }
+  return steps;
+}
+
+//! Return the step of the last full snapshot at or before a step
+mpm::Index mpm::Checkpoint::full_step(
+    const std::function<std::string(mpm::Index)>& filename,
+    mpm::Index step) {
+  return snapshot_steps(filename, step).back();
+}
+
+//! Reconstruct the particles of a step
+std::vector<mpm::HDF5Particle> mpm::Checkpoint::read(
+    const std::function<std::string(mpm::Index)>& filename,
+    mpm::Index step) {
+  // Apply the checkpoints from the full snapshot to the step
+  const auto steps = snapshot_steps(filename, step);
+  std::vector<HDF5Particle> particles;
+  for (auto sitr = steps.crbegin(); sitr != steps.crend(); ++sitr)
+    particles = read_snapshot(filename(*sitr), std::move(particles));
+  return particles;
+}
+
+//! Apply a checkpoint to the particles of the previous checkpoint
+std::vector<mpm::HDF5Particle> mpm::Checkpoint::read_snapshot(
+    const std::string& file, std::vector<HDF5Particle> reference) {
+  hid_t file_id = H5Fopen(file.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (file_id < 0)
+    throw std::runtime_error("Checkpoint file " + file + " is not found");
+
+  long long nrecords = 0;
+  H5LTget_attribute_long_long(file_id, "/", "nparticles", &nrecords);
+  const size_t nparticles = static_cast<size_t>(nrecords);
+
+  std::vector<HDF5Particle> particles;
+  try {
+    // Particles in the order of the checkpoint
+    if (H5LTfind_dataset(file_id, "ids") > 0) {
+      hsize_t dims[1] = {0};
+      H5LTget_dataset_info(file_id, "ids", dims, nullptr, nullptr);
+      if (dims[0] != nparticles)
+        throw std::runtime_error("Checkpoint ids have incorrect size");
+      std::vector<unsigned long long> ids(nparticles);
+      H5LTread_dataset(file_id, "ids", H5T_NATIVE_ULLONG, ids.data());
+
+      std::unordered_map<mpm::Index, size_t> reference_index;
+      reference_index.reserve(reference.size());
+      for (size_t i = 0; i < reference.size(); ++i)
+        reference_index.emplace(reference[i].id, i);
+      particles.resize(nparticles);
+      for (size_t i = 0; i < nparticles; ++i) {
+        const auto itr = reference_index.find(ids[i]);
+        if (itr != reference_index.end()) {
+          particles[i] = reference[itr->second];
+        } else {
+          particles[i] = HDF5Particle();
+          particles[i].id = ids[i];
+        }
+      }
+    } else {
+      if (reference.size() != nparticles)
+        throw std::runtime_error("Checkpoint has no particle ids");
+      particles = std::move(reference);
+    }
+
+    // Assign changed real fields
+    std::vector<unsigned long long> indices;
+    std::vector<double> values;
+    const auto& first_fields = group_fields();
+    for (unsigned g = 0; g < NGROUPS; ++g) {
+      const auto& group = field_groups[g];
+      if (!read_changes(file_id, group.name, H5T_NATIVE_DOUBLE, group.nfields,
+                        nparticles, &indices, &values))
+        continue;
+      for (size_t i = 0; i < indices.size(); ++i)
+        for (unsigned j = 0; j < group.nfields; ++j)
+          field(particles[indices[i]], first_fields[g] + j) =
+              values[i * group.nfields + j];
+    }
+
+    // Assign changed integer fields
+    std::vector<unsigned long long> states;
+    if (read_changes(file_id, "state", H5T_NATIVE_ULLONG, NSTATE_FIELDS,
+                     nparticles, &indices, &states))
+      for (size_t i = 0; i < indices.size(); ++i)
+        assign_state(&states[i * NSTATE_FIELDS], &particles[indices[i]]);
+  } catch (...) {
+    H5Fclose(file_id);
+    throw;
+  }
+
+  H5Fclose(file_id);
+  return particles;
+}
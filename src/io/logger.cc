@@ -35,3 +35,7 @@ const std::shared_ptr<spdlog::logger> mpm::Logger::mpm_explicit_usf_logger =
 // Create a logger for MPM Explicit USL
 const std::shared_ptr<spdlog::logger> mpm::Logger::mpm_explicit_usl_logger =
     spdlog::stdout_color_st("MPMExplicitUSL");
+
+// Create a logger for MPM Implicit
+const std::shared_ptr<spdlog::logger> mpm::Logger::mpm_implicit_logger =
+    spdlog::stdout_color_st("MPMImplicit");
@@ -4,6 +4,7 @@
 #include "io.h"
 #include "mpm.h"
 #include "mpm_explicit.h"
+#include "mpm_implicit.h"
 
 namespace mpm {
 // 2D Explicit MPM
@@ -14,4 +15,12 @@ static Register<mpm::MPM, mpm::MPMExplicit<2>, const std::shared_ptr<mpm::IO>&>
 static Register<mpm::MPM, mpm::MPMExplicit<3>, const std::shared_ptr<mpm::IO>&>
     mpm_explicit_3d("MPMExplicit3D");
 
+// 2D Implicit MPM
+static Register<mpm::MPM, mpm::MPMImplicit<2>, const std::shared_ptr<mpm::IO>&>
+    mpm_implicit_2d("MPMImplicit2D");
+
+// 3D Implicit MPM
+static Register<mpm::MPM, mpm::MPMImplicit<3>, const std::shared_ptr<mpm::IO>&>
+    mpm_implicit_3d("MPMImplicit3D");
+
 }  // namespace mpm
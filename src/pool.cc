@@ -0,0 +1,83 @@
+#include "pool.h"
+
+#include <cstdint>
+#include <mutex>
+
+//! Constructor with number of slots per slab
+mpm::Pool::Pool(std::size_t nslots_per_slab)
+    : nslots_per_slab_{(nslots_per_slab > 0) ? nslots_per_slab : 1} {}
+
+//! Round object size up to the slot alignment
+std::size_t mpm::Pool::slot_size(std::size_t size) {
+  const std::size_t alignment = Pool::alignment();
+  return ((size + alignment - 1) / alignment) * alignment;
+}
+
+//! Append a slab to a slot list
+void mpm::Pool::add_slab(std::size_t size, Slots* slots) {
+  const std::size_t alignment = Pool::alignment();
+  slots->slabs.emplace_back(new char[size * nslots_per_slab_ + alignment - 1]);
+  // First slot is aligned, slot sizes are multiples of the alignment
+  const auto address =
+      reinterpret_cast<std::uintptr_t>(slots->slabs.back().get());
+  char* slab = slots->slabs.back().get() +
+               (alignment - address % alignment) % alignment;
+  slots->free_slots.reserve(slots->free_slots.size() + nslots_per_slab_);
+  // Push in reverse to hand out slots in address order
+  for (std::size_t i = nslots_per_slab_; i > 0; --i)
+    slots->free_slots.emplace_back(slab + (i - 1) * size);
+}
+
+//! Allocate a slot
+void* mpm::Pool::allocate(std::size_t size) {
+  const std::size_t ssize = slot_size(size);
+  std::lock_guard<mpm::SpinMutex> guard(pool_mutex_);
+  auto& slots = slots_[ssize];
+  if (slots.free_slots.empty()) this->add_slab(ssize, &slots);
+  void* ptr = slots.free_slots.back();
+  slots.free_slots.pop_back();
+  ++slots.nallocated;
+  return ptr;
+}
+
+//! Return a slot to the pool
+void mpm::Pool::deallocate(void* ptr, std::size_t size) {
+  if (ptr == nullptr) return;
+  const std::size_t ssize = slot_size(size);
+  std::lock_guard<mpm::SpinMutex> guard(pool_mutex_);
+  auto& slots = slots_.at(ssize);
+  slots.free_slots.emplace_back(ptr);
+  --slots.nallocated;
+}
+
+//! Reserve free slots
+void mpm::Pool::reserve(std::size_t size, std::size_t nslots) {
+  const std::size_t ssize = slot_size(size);
+  std::lock_guard<mpm::SpinMutex> guard(pool_mutex_);
+  auto& slots = slots_[ssize];
+  while (slots.free_slots.size() < nslots) this->add_slab(ssize, &slots);
+}
+
+//! Return the number of slots in use
+std::size_t mpm::Pool::nallocated() const {
+  std::lock_guard<mpm::SpinMutex> guard(pool_mutex_);
+  std::size_t nallocated = 0;
+  for (const auto& slots : slots_) nallocated += slots.second.nallocated;
+  return nallocated;
+}
+
+//! Return the number of free slots
+std::size_t mpm::Pool::nfree() const {
+  std::lock_guard<mpm::SpinMutex> guard(pool_mutex_);
+  std::size_t nfree = 0;
+  for (const auto& slots : slots_) nfree += slots.second.free_slots.size();
+  return nfree;
+}
+
+//! Return the number of slabs
+std::size_t mpm::Pool::nslabs() const {
+  std::lock_guard<mpm::SpinMutex> guard(pool_mutex_);
+  std::size_t nslabs = 0;
+  for (const auto& slots : slots_) nslabs += slots.second.slabs.size();
+  return nslabs;
+}
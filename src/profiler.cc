@@ -0,0 +1,189 @@
+#include "profiler.h"
+
+#include <fstream>
+#include <mutex>
+#include <sstream>
+
+#ifdef USE_MPI
+#include "mpi.h"
+#endif
+
+namespace {
+//! Scopes of the calling thread
+thread_local std::vector<std::string> scopes;
+}  // namespace
+
+//! Return the profiler of the process
+mpm::Profiler* mpm::Profiler::instance() {
+  static Profiler profiler;
+  return &profiler;
+}
+
+//! Enter a scope of the calling thread
+std::string mpm::Profiler::push_scope(const char* name) {
+  std::string path = scopes.empty() ? name : scopes.back() + "/" + name;
+  scopes.emplace_back(path);
+  return path;
+}
+
+//! Leave the innermost scope of the calling thread
+void mpm::Profiler::pop_scope() {
+  if (!scopes.empty()) scopes.pop_back();
+}
+
+//! Add elapsed time to a timer
+void mpm::Profiler::add_time(const std::string& path, double seconds) {
+  std::lock_guard<mpm::SpinMutex> guard(mutex_);
+  auto& timer = timers_[path];
+  timer.seconds += seconds;
+  ++timer.ncalls;
+}
+
+//! Add to a counter
+void mpm::Profiler::add_count(const std::string& name, double value) {
+  if (!enabled_) return;
+  std::lock_guard<mpm::SpinMutex> guard(mutex_);
+  counters_[name] += value;
+}
+
+//! Clear timers and counters
+void mpm::Profiler::reset() {
+  std::lock_guard<mpm::SpinMutex> guard(mutex_);
+  timers_.clear();
+  counters_.clear();
+}
+
+//! Return the time of a timer on this rank
+double mpm::Profiler::time(const std::string& path) const {
+  std::lock_guard<mpm::SpinMutex> guard(mutex_);
+  const auto titr = timers_.find(path);
+  return (titr != timers_.end()) ? titr->second.seconds : 0.;
+}
+
+//! Return the number of calls of a timer on this rank
+unsigned long long mpm::Profiler::ncalls(const std::string& path) const {
+  std::lock_guard<mpm::SpinMutex> guard(mutex_);
+  const auto titr = timers_.find(path);
+  return (titr != timers_.end()) ? titr->second.ncalls : 0;
+}
+
+//! Return the value of a counter on this rank
+double mpm::Profiler::count(const std::string& name) const {
+  std::lock_guard<mpm::SpinMutex> guard(mutex_);
+  const auto citr = counters_.find(name);
+  return (citr != counters_.end()) ? citr->second : 0.;
+}
+
+//! Report of timers and counters reduced over MPI ranks
+Json mpm::Profiler::report() const {
+  // Entries of this rank: time and calls of timers followed by counters
+  std::vector<std::string> timers, counters;
+  std::vector<double> values;
+  {
+    std::lock_guard<mpm::SpinMutex> guard(mutex_);
+    for (const auto& timer : timers_) timers.emplace_back(timer.first);
+    for (const auto& counter : counters_) counters.emplace_back(counter.first);
+  }
+
+  int mpi_size = 1;
+#ifdef USE_MPI
+  int mpi_initialized = 0;
+  MPI_Initialized(&mpi_initialized);
+  if (mpi_initialized) {
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    if (mpi_size > 1) {
+      // Entries of rank 0 as one newline separated string
+      std::string names;
+      for (const auto& timer : timers) names += timer + "\n";
+      names += "\n";
+      for (const auto& counter : counters) names += counter + "\n";
+      int length = names.size();
+      MPI_Bcast(&length, 1, MPI_INT, 0, MPI_COMM_WORLD);
+      names.resize(length);
+      MPI_Bcast(&names[0], length, MPI_CHAR, 0, MPI_COMM_WORLD);
+
+      timers.clear();
+      counters.clear();
+      std::istringstream stream(names);
+      std::string name;
+      bool is_timer = true;
+      while (std::getline(stream, name)) {
+        if (name.empty())
+          is_timer = false;
+        else if (is_timer)
+          timers.emplace_back(name);
+        else
+          counters.emplace_back(name);
+      }
+    }
+  }
+#endif
+
+  for (const auto& timer : timers) {
+    values.emplace_back(this->time(timer));
+    values.emplace_back(static_cast<double>(this->ncalls(timer)));
+  }
+  for (const auto& counter : counters) values.emplace_back(this->count(counter));
+
+  std::vector<double> min_values(values), max_values(values), sum_values(values);
+#ifdef USE_MPI
+  if (mpi_size > 1 && !values.empty()) {
+    MPI_Allreduce(values.data(), min_values.data(), values.size(), MPI_DOUBLE,
+                  MPI_MIN, MPI_COMM_WORLD);
+    MPI_Allreduce(values.data(), max_values.data(), values.size(), MPI_DOUBLE,
+                  MPI_MAX, MPI_COMM_WORLD);
+    MPI_Allreduce(values.data(), sum_values.data(), values.size(), MPI_DOUBLE,
+                  MPI_SUM, MPI_COMM_WORLD);
+  }
+#endif
+
+  Json report;
+  report["nranks"] = mpi_size;
+  report["timers"] = Json::object();
+  report["counters"] = Json::object();
+  unsigned i = 0;
+  for (const auto& timer : timers) {
+    report["timers"][timer] = {{"min", min_values[i]},
+                               {"mean", sum_values[i] / mpi_size},
+                               {"max", max_values[i]},
+                               {"calls", static_cast<unsigned long long>(
+                                             max_values[i + 1])}};
+    i += 2;
+  }
+  for (const auto& counter : counters) {
+    report["counters"][counter] = {{"min", min_values[i]},
+                                   {"mean", sum_values[i] / mpi_size},
+                                   {"max", max_values[i]}};
+    ++i;
+  }
+  return report;
+}
+
+//! Write the report as JSON and CSV files on rank 0
+bool mpm::Profiler::write(const std::string& filename) const {
+  const Json report = this->report();
+
+  int mpi_rank = 0;
+#ifdef USE_MPI
+  int mpi_initialized = 0;
+  MPI_Initialized(&mpi_initialized);
+  if (mpi_initialized) MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
+  if (mpi_rank != 0) return true;
+
+  std::ofstream json_file(filename + ".json");
+  json_file << report.dump(2) << "\n";
+
+  std::ofstream csv_file(filename + ".csv");
+  csv_file << "type,name,calls,min,mean,max\n";
+  for (const auto& timer : report["timers"].items())
+    csv_file << "timer," << timer.key() << "," << timer.value()["calls"] << ","
+             << timer.value()["min"] << "," << timer.value()["mean"] << ","
+             << timer.value()["max"] << "\n";
+  for (const auto& counter : report["counters"].items())
+    csv_file << "counter," << counter.key() << ",," << counter.value()["min"]
+             << "," << counter.value()["mean"] << "," << counter.value()["max"]
+             << "\n";
+
+  return json_file.good() && csv_file.good();
+}
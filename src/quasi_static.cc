@@ -0,0 +1,92 @@
+#include "quasi_static.h"
+
+#include <cmath>
+#include <stdexcept>
+
+//! Constructor with quasi-static properties
+mpm::QuasiStatic::QuasiStatic(const Json& props) {
+  if (props.find("damping") != props.end()) {
+    const auto damping = props.at("damping").template get<std::string>();
+    if (damping == "kinetic")
+      damping_ = mpm::QuasiStaticDamping::Kinetic;
+    else if (damping == "viscous")
+      damping_ = mpm::QuasiStaticDamping::Viscous;
+    else
+      throw std::runtime_error("Quasi-static damping " + damping +
+                               " is not supported");
+  }
+  if (props.find("damping_ratio") != props.end())
+    damping_ratio_ = props.at("damping_ratio").template get<double>();
+  if (props.find("mass_scaling") != props.end())
+    mass_scaling_ = props.at("mass_scaling").template get<double>();
+  if (props.find("tolerance") != props.end())
+    tolerance_ = props.at("tolerance").template get<double>();
+  if (props.find("min_steps") != props.end())
+    min_steps_ = props.at("min_steps").template get<unsigned>();
+  if (props.find("terminate") != props.end())
+    terminate_ = props.at("terminate").template get<bool>();
+
+  if (mass_scaling_ <= 0.)
+    throw std::runtime_error("Quasi-static mass scaling should be positive");
+}
+
+//! Update with the state at the end of a step
+void mpm::QuasiStatic::update(double time, double kinetic_energy,
+                              double unbalanced_ratio) {
+  ++nsteps_;
+  reset_velocities_ = false;
+
+  // Kinetic energy of the previous step is a peak
+  const bool peak = rising_ && kinetic_energy < kinetic_energy_;
+  rising_ = kinetic_energy > kinetic_energy_;
+
+  if (peak) {
+    if (damping_ == mpm::QuasiStaticDamping::Kinetic) {
+      // Velocities are reset, the energy rises again from zero
+      reset_velocities_ = true;
+      rising_ = false;
+      kinetic_energy = 0.;
+    } else {
+      // Peaks of the kinetic energy are half a period apart, the lowest
+      // frequency observed is damped
+      if (peak_time_ >= 0. && time_ > peak_time_) {
+        const double frequency = M_PI / (time_ - peak_time_);
+        const double coefficient = 2. * damping_ratio_ * frequency;
+        if (damping_coefficient_ == 0. || coefficient < damping_coefficient_)
+          damping_coefficient_ = coefficient;
+      }
+      peak_time_ = time_;
+    }
+  }
+  kinetic_energy_ = kinetic_energy;
+  time_ = time;
+
+  unbalanced_ratio_ = unbalanced_ratio;
+  converged_ = (nsteps_ >= min_steps_ && unbalanced_ratio_ < tolerance_);
+}
+
+//! Return the state of the damping and convergence to resume from
+Json mpm::QuasiStatic::state() const {
+  Json state;
+  state["nsteps"] = nsteps_;
+  state["kinetic_energy"] = kinetic_energy_;
+  state["time"] = time_;
+  state["rising"] = rising_;
+  state["peak_time"] = peak_time_;
+  state["damping_coefficient"] = damping_coefficient_;
+  state["unbalanced_ratio"] = unbalanced_ratio_;
+  state["converged"] = converged_;
+  return state;
+}
+
+//! Assign the state of the damping and convergence of a resumed run
+void mpm::QuasiStatic::assign_state(const Json& state) {
+  nsteps_ = state.at("nsteps").template get<unsigned>();
+  kinetic_energy_ = state.at("kinetic_energy").template get<double>();
+  time_ = state.at("time").template get<double>();
+  rising_ = state.at("rising").template get<bool>();
+  peak_time_ = state.at("peak_time").template get<double>();
+  damping_coefficient_ = state.at("damping_coefficient").template get<double>();
+  unbalanced_ratio_ = state.at("unbalanced_ratio").template get<double>();
+  converged_ = state.at("converged").template get<bool>();
+}
@@ -0,0 +1,69 @@
+#include <set>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "cell_list.h"
+
+//! \brief Check cell list class
+TEST_CASE("Cell list is checked", "[cell_list]") {
+  mpm::CellList cell_list;
+
+  // Cells 0, 1 and 2 in a row, cell 3 is empty
+  REQUIRE(cell_list.add_cell(0, 2) == true);
+  REQUIRE(cell_list.add_cell(1, 3) == true);
+  REQUIRE(cell_list.add_cell(2, 1) == true);
+  REQUIRE(cell_list.add_cell(3, 0) == true);
+  REQUIRE(cell_list.add_cell(1, 3) == false);
+  cell_list.allocate();
+
+  REQUIRE(cell_list.ncells() == 4);
+  REQUIRE(cell_list.nparticles() == 6);
+  REQUIRE(cell_list.contains(2) == true);
+  REQUIRE(cell_list.contains(4) == false);
+
+  // Particles of cells
+  std::vector<mpm::Index> p0{10, 11}, p1{12, 13, 14}, p2{15};
+  cell_list.assign_particles(0, p0.cbegin(), p0.cend());
+  cell_list.assign_particles(1, p1.cbegin(), p1.cend());
+  cell_list.assign_particles(2, p2.cbegin(), p2.cend());
+
+  // Neighbours of cells, cell 4 is not in the list
+  cell_list.assign_neighbours(0, std::set<mpm::Index>{1});
+  cell_list.assign_neighbours(1, std::set<mpm::Index>{0, 2});
+  cell_list.assign_neighbours(2, std::set<mpm::Index>{1, 4});
+
+  SECTION("Check particles of a cell") {
+    const auto range = cell_list.particles(1);
+    REQUIRE(range.size() == 3);
+    REQUIRE(std::vector<mpm::Index>(range.begin(), range.end()) == p1);
+    REQUIRE(cell_list.particles(3).empty() == true);
+  }
+
+  SECTION("Check neighbour ranges of a cell") {
+    // Cell comes first, followed by its neighbours in ascending order
+    const auto ranges = cell_list.neighbour_ranges(1);
+    REQUIRE(ranges.size() == 3);
+    REQUIRE(*ranges[0].begin() == 12);
+    REQUIRE(*ranges[1].begin() == 10);
+    REQUIRE(*ranges[2].begin() == 15);
+    REQUIRE(cell_list.nneighbours(1) == 6);
+
+    // Absent neighbour is skipped
+    REQUIRE(cell_list.neighbour_ranges(2).size() == 2);
+    REQUIRE(cell_list.nneighbours(2) == 4);
+
+    std::vector<mpm::Index> neighbours;
+    cell_list.iterate_over_neighbours(
+        0, [&neighbours](mpm::Index pid) { neighbours.emplace_back(pid); });
+    const std::vector<mpm::Index> p01{10, 11, 12, 13, 14};
+    REQUIRE(neighbours == p01);
+  }
+
+  SECTION("Check clear") {
+    cell_list.clear();
+    REQUIRE(cell_list.ncells() == 0);
+    REQUIRE(cell_list.nparticles() == 0);
+    REQUIRE(cell_list.contains(0) == false);
+  }
+}
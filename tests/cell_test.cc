@@ -211,6 +211,9 @@ TEST_CASE("Cell is checked for 2D case", "[cell][2D]") {
       }
 
       SECTION("Check if a point is in a cell") {
+        // Square cell has an exact affine transformation
+        REQUIRE(cell->is_parallelepiped() == true);
+
         Eigen::Vector2d xi;
         // Check point in cell
         Eigen::Vector2d point;
@@ -1402,11 +1405,18 @@ TEST_CASE("Cell is checked for 3D case", "[cell][3D]") {
 
     REQUIRE(cell->initialise() == true);
 
+    // Distorted cell is located by Newton-Raphson iterations
+    REQUIRE(cell->is_parallelepiped() == false);
+
     Eigen::Vector3d xi;
     // Check point in cell
     Eigen::Vector3d point;
     point << 812482.5000000000, 815878.5000000000, 160.0825000000;
     REQUIRE(cell->is_point_in_cell(point, &xi) == true);
+
+    // Check point outside the bounding box of the cell
+    point << 812482.5000000000, 815878.5000000000, 170.0000000000;
+    REQUIRE(cell->is_point_in_cell(point, &xi) == false);
   }
 
   // Check if a point is in an oblique cell
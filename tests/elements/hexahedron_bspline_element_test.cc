@@ -0,0 +1,67 @@
+// Hexahedron B-spline element test
+#include <memory>
+
+#include "catch.hpp"
+
+#include "hexahedron_bspline_element.h"
+
+//! \brief Check hexahedron B-spline element class
+TEST_CASE("Hexahedron B-spline elements are checked",
+          "[hex][element][3D][bspline]") {
+  const unsigned Dim = 3;
+  const unsigned nfunctions = 64;
+  const double Tolerance = 1.E-7;
+  using HexBSpline2 = mpm::HexahedronBSplineElement<Dim, nfunctions, 2>;
+  using HexBSpline3 = mpm::HexahedronBSplineElement<Dim, nfunctions, 3>;
+
+  // Particle size and deformation gradient are not used
+  Eigen::Matrix<double, Dim, 1> psize;
+  psize.setZero();
+  Eigen::Matrix<double, Dim, 1> defgrad;
+  defgrad.setZero();
+
+  //! Check quadratic B-spline
+  SECTION("64 Node Hexahedron quadratic B-spline Element") {
+    std::shared_ptr<mpm::Element<Dim>> hex = std::make_shared<HexBSpline2>();
+
+    REQUIRE(hex->nfunctions() == nfunctions);
+    REQUIRE(hex->shapefn_type() == mpm::ShapefnType::BSPLINE);
+
+    // Centre of the cell: only the corner nodes contribute
+    Eigen::Matrix<double, Dim, 1> xi;
+    xi.setZero();
+
+    auto shapefn = hex->shapefn(xi, psize, defgrad);
+    REQUIRE(shapefn.size() == nfunctions);
+    for (unsigned i = 0; i < 8; ++i)
+      REQUIRE(shapefn(i) == Approx(0.125).epsilon(Tolerance));
+    for (unsigned i = 8; i < nfunctions; ++i)
+      REQUIRE(shapefn(i) == Approx(0.).margin(Tolerance));
+
+    auto gradsf = hex->grad_shapefn(xi, psize, defgrad);
+    REQUIRE(gradsf.rows() == nfunctions);
+    REQUIRE(gradsf.cols() == Dim);
+    for (unsigned i = 0; i < 8; ++i)
+      for (unsigned j = 0; j < Dim; ++j)
+        REQUIRE(std::fabs(gradsf(i, j)) == Approx(0.125).epsilon(Tolerance));
+  }
+
+  //! Check partition of unity
+  SECTION("Hexahedron B-spline partition of unity") {
+    std::vector<std::shared_ptr<mpm::Element<Dim>>> elements{
+        std::make_shared<HexBSpline2>(), std::make_shared<HexBSpline3>()};
+
+    for (const auto& hex : elements) {
+      Eigen::Matrix<double, Dim, 1> xi;
+      xi << 0.3, -0.7, 0.9;
+
+      auto shapefn = hex->shapefn(xi, psize, defgrad);
+      auto gradsf = hex->grad_shapefn(xi, psize, defgrad);
+
+      REQUIRE(shapefn.sum() == Approx(1.).epsilon(Tolerance));
+      REQUIRE(shapefn.minCoeff() >= 0.);
+      for (unsigned i = 0; i < Dim; ++i)
+        REQUIRE(gradsf.col(i).sum() == Approx(0.).margin(Tolerance));
+    }
+  }
+}
@@ -0,0 +1,154 @@
+// Quadrilateral B-spline element test
+#include <memory>
+
+#include "catch.hpp"
+
+#include "quadrilateral_bspline_element.h"
+
+//! \brief Check quadrilateral B-spline element class
+TEST_CASE("Quadrilateral B-spline elements are checked",
+          "[quad][element][2D][bspline]") {
+  const unsigned Dim = 2;
+  const unsigned nfunctions = 16;
+  const double Tolerance = 1.E-7;
+  using QuadBSpline2 = mpm::QuadrilateralBSplineElement<Dim, nfunctions, 2>;
+  using QuadBSpline3 = mpm::QuadrilateralBSplineElement<Dim, nfunctions, 3>;
+
+  // Nodal coordinates of a GIMP / B-spline cell of size 2 x 2
+  // clang-format off
+  Eigen::Matrix<double, nfunctions, Dim> coords;
+  coords << -1., -1.,
+             1., -1.,
+             1.,  1.,
+            -1.,  1.,
+            -3., -3.,
+            -1., -3.,
+             1., -3.,
+             3., -3.,
+             3., -1.,
+             3.,  1.,
+             3.,  3.,
+             1.,  3.,
+            -1.,  3.,
+            -3.,  3.,
+            -3.,  1.,
+            -3., -1.;
+  // clang-format on
+
+  // Particle size and deformation gradient are not used
+  Eigen::Matrix<double, Dim, 1> psize;
+  psize.setZero();
+  Eigen::Matrix<double, Dim, 1> defgrad;
+  defgrad.setZero();
+
+  //! Check quadratic B-spline
+  SECTION("16 Node Quadrilateral quadratic B-spline Element") {
+    std::shared_ptr<mpm::Element<Dim>> quad = std::make_shared<QuadBSpline2>();
+
+    REQUIRE(quad->nfunctions() == nfunctions);
+    REQUIRE(quad->shapefn_type() == mpm::ShapefnType::BSPLINE);
+
+    // Centre of the cell
+    Eigen::Matrix<double, Dim, 1> xi;
+    xi.setZero();
+
+    auto shapefn = quad->shapefn(xi, psize, defgrad);
+    REQUIRE(shapefn.size() == nfunctions);
+    for (unsigned i = 0; i < 4; ++i)
+      REQUIRE(shapefn(i) == Approx(0.25).epsilon(Tolerance));
+    for (unsigned i = 4; i < nfunctions; ++i)
+      REQUIRE(shapefn(i) == Approx(0.).margin(Tolerance));
+
+    auto gradsf = quad->grad_shapefn(xi, psize, defgrad);
+    REQUIRE(gradsf.rows() == nfunctions);
+    REQUIRE(gradsf.cols() == Dim);
+    REQUIRE(gradsf(0, 0) == Approx(-0.25).epsilon(Tolerance));
+    REQUIRE(gradsf(1, 0) == Approx(0.25).epsilon(Tolerance));
+    REQUIRE(gradsf(2, 0) == Approx(0.25).epsilon(Tolerance));
+    REQUIRE(gradsf(3, 0) == Approx(-0.25).epsilon(Tolerance));
+    REQUIRE(gradsf(0, 1) == Approx(-0.25).epsilon(Tolerance));
+    REQUIRE(gradsf(1, 1) == Approx(-0.25).epsilon(Tolerance));
+    REQUIRE(gradsf(2, 1) == Approx(0.25).epsilon(Tolerance));
+    REQUIRE(gradsf(3, 1) == Approx(0.25).epsilon(Tolerance));
+
+    // Corner of the cell: three nodes per axis contribute
+    xi << -1., -1.;
+    shapefn = quad->shapefn(xi, psize, defgrad);
+    REQUIRE(shapefn(0) == Approx(0.5625).epsilon(Tolerance));
+    REQUIRE(shapefn(4) == Approx(0.015625).epsilon(Tolerance));
+    REQUIRE(shapefn(5) == Approx(0.09375).epsilon(Tolerance));
+    REQUIRE(shapefn(7) == Approx(0.).margin(Tolerance));
+    REQUIRE(shapefn(10) == Approx(0.).margin(Tolerance));
+  }
+
+  //! Check cubic B-spline
+  SECTION("16 Node Quadrilateral cubic B-spline Element") {
+    std::shared_ptr<mpm::Element<Dim>> quad = std::make_shared<QuadBSpline3>();
+
+    REQUIRE(quad->nfunctions() == nfunctions);
+
+    // Centre of the cell: all 4 nodes per axis contribute
+    Eigen::Matrix<double, Dim, 1> xi;
+    xi.setZero();
+
+    auto shapefn = quad->shapefn(xi, psize, defgrad);
+    REQUIRE(shapefn(0) == Approx(529. / 2304.).epsilon(Tolerance));
+    REQUIRE(shapefn(4) == Approx(1. / 2304.).epsilon(Tolerance));
+    REQUIRE(shapefn(5) == Approx(23. / 2304.).epsilon(Tolerance));
+    REQUIRE(shapefn(10) == Approx(1. / 2304.).epsilon(Tolerance));
+  }
+
+  //! Check partition of unity and linear completeness
+  SECTION("Quadrilateral B-spline reproduces linear fields") {
+    std::vector<std::shared_ptr<mpm::Element<Dim>>> elements{
+        std::make_shared<QuadBSpline2>(), std::make_shared<QuadBSpline3>()};
+
+    for (const auto& quad : elements) {
+      Eigen::Matrix<double, Dim, 1> xi;
+      xi << 0.3, -0.7;
+
+      auto shapefn = quad->shapefn(xi, psize, defgrad);
+      auto gradsf = quad->grad_shapefn(xi, psize, defgrad);
+
+      REQUIRE(shapefn.sum() == Approx(1.).epsilon(Tolerance));
+      REQUIRE(shapefn.minCoeff() >= 0.);
+      for (unsigned i = 0; i < Dim; ++i)
+        REQUIRE(gradsf.col(i).sum() == Approx(0.).margin(Tolerance));
+
+      // Interpolated coordinates and their gradient
+      const Eigen::Matrix<double, Dim, 1> x = coords.transpose() * shapefn;
+      for (unsigned i = 0; i < Dim; ++i)
+        REQUIRE(x(i) == Approx(xi(i)).epsilon(Tolerance));
+
+      const auto jacobian = quad->jacobian(xi, coords, psize, defgrad);
+      REQUIRE((jacobian - Eigen::Matrix2d::Identity()).norm() ==
+              Approx(0.).margin(Tolerance));
+
+      // B-matrix of a cell of size 2 is the natural gradient
+      const auto bmatrix = quad->bmatrix(xi, coords, psize, defgrad);
+      REQUIRE(bmatrix.size() == nfunctions);
+      for (unsigned n = 0; n < nfunctions; ++n) {
+        REQUIRE(bmatrix.at(n)(0, 0) == Approx(gradsf(n, 0)).margin(Tolerance));
+        REQUIRE(bmatrix.at(n)(1, 1) == Approx(gradsf(n, 1)).margin(Tolerance));
+      }
+    }
+  }
+
+  //! Check analytical natural coordinates
+  SECTION("Quadrilateral B-spline analytical natural coordinates") {
+    std::shared_ptr<mpm::Element<Dim>> quad = std::make_shared<QuadBSpline2>();
+
+    REQUIRE(quad->isvalid_natural_coordinates_analytical() == true);
+
+    // Cell of size 2 x 4 with the origin at its lower left corner
+    Eigen::Matrix<double, nfunctions, Dim> nodes = coords;
+    nodes.col(0) = (nodes.col(0).array() + 1.).matrix();
+    nodes.col(1) = (2. * (nodes.col(1).array() + 1.)).matrix();
+
+    Eigen::Matrix<double, Dim, 1> point;
+    point << 0.5, 3.;
+    const auto xi = quad->natural_coordinates_analytical(point, nodes);
+    REQUIRE(xi(0) == Approx(-0.5).epsilon(Tolerance));
+    REQUIRE(xi(1) == Approx(0.5).epsilon(Tolerance));
+  }
+}
@@ -0,0 +1,134 @@
+#ifndef MPM_TEST_MATERIAL_BATCH_H_
+#define MPM_TEST_MATERIAL_BATCH_H_
+
+#include <memory>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "cell.h"
+#include "material.h"
+#include "particle.h"
+#include "particle_base.h"
+
+namespace mpm_test {
+
+//! Check the batched stress update of a material against updates of single
+//! particles, with a different strain increment and particle for each column
+//! \param[in] material Material to check
+//! \param[in] stress Initial stress of the particles
+//! \param[in] dstrain Strain increment, scaled for each particle
+//! \param[in] particles Particles of the stress update of each column
+//! \param[in] tolerance Relative tolerance
+template <unsigned Tdim>
+void check_batch_stresses(
+    const std::shared_ptr<mpm::Material<Tdim>>& material,
+    const typename mpm::Material<Tdim>::Vector6d& stress,
+    const typename mpm::Material<Tdim>::Vector6d& dstrain,
+    const std::vector<const mpm::ParticleBase<Tdim>*>& particles,
+    double tolerance) {
+  const std::vector<double> scales{1., 0.5, 2.};
+  const unsigned nparticles = particles.size();
+  REQUIRE(nparticles <= scales.size());
+
+  typename mpm::Material<Tdim>::Matrix6X stresses(6, nparticles);
+  typename mpm::Material<Tdim>::Matrix6X dstrains(6, nparticles);
+  std::vector<mpm::dense_map> state_vars(
+      nparticles, material->initialise_state_variables());
+  std::vector<mpm::dense_map*> state_vars_ptrs;
+  for (unsigned i = 0; i < nparticles; ++i) {
+    stresses.col(i) = stress;
+    dstrains.col(i) = scales[i] * dstrain;
+    state_vars_ptrs.emplace_back(&state_vars[i]);
+  }
+  material->compute_stresses(&stresses, dstrains, particles, state_vars_ptrs);
+
+  for (unsigned i = 0; i < nparticles; ++i) {
+    // Single particle update
+    auto single_state_vars = material->initialise_state_variables();
+    const auto single_stress = material->compute_stress(
+        stress, dstrains.col(i), particles[i], &single_state_vars);
+    for (unsigned j = 0; j < 6; ++j)
+      REQUIRE(stresses(j, i) ==
+              Approx(single_stress(j)).epsilon(tolerance).margin(tolerance));
+    for (const auto& state_var : single_state_vars)
+      REQUIRE(state_vars[i].at(state_var.first) ==
+              Approx(state_var.second).epsilon(tolerance).margin(tolerance));
+  }
+}
+
+//! Check the batched stress update of a material against updates of single
+//! particles, with a different strain increment for each particle
+//! \param[in] material Material to check
+//! \param[in] stress Initial stress of the particles
+//! \param[in] dstrain Strain increment, scaled for each particle
+//! \param[in] particle Particle of the stress update
+//! \param[in] tolerance Relative tolerance
+template <unsigned Tdim>
+void check_batch_stresses(
+    const std::shared_ptr<mpm::Material<Tdim>>& material,
+    const typename mpm::Material<Tdim>::Vector6d& stress,
+    const typename mpm::Material<Tdim>::Vector6d& dstrain,
+    const mpm::ParticleBase<Tdim>* particle, double tolerance) {
+  check_batch_stresses<Tdim>(
+      material, stress, dstrain,
+      std::vector<const mpm::ParticleBase<Tdim>*>(3, particle), tolerance);
+}
+
+//! Create particles at different locations of a cell, whose strain rates
+//! differ, to check batched stress updates of rate dependent materials
+//! \param[in] cell Cell of the particles, with nodal velocities
+//! \param[in] material Material of the particles
+//! \param[in] dt Time step to compute strains
+//! \retval particles Particles at coordinates 0.5, -1 and 1.5 along each axis
+template <unsigned Tdim>
+std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>> batch_particles(
+    const std::shared_ptr<mpm::Cell<Tdim>>& cell,
+    const std::shared_ptr<mpm::Material<Tdim>>& material, double dt) {
+  std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>> particles;
+  // Ids past those of the particles of the tests
+  mpm::Index id = 100;
+  for (const double coordinate : {0.5, -1., 1.5}) {
+    Eigen::Matrix<double, Tdim, 1> coords;
+    coords.fill(coordinate);
+    auto particle = std::make_shared<mpm::Particle<Tdim>>(id++, coords);
+    REQUIRE(particle->assign_cell(cell) == true);
+    REQUIRE(particle->assign_material(material) == true);
+    particle->compute_shapefn();
+    particle->compute_strain(dt);
+    particles.emplace_back(particle);
+  }
+  return particles;
+}
+
+//! Check the batched stress update of a rate dependent material with a
+//! different particle, and hence strain rate, for each column
+//! \param[in] material Material to check
+//! \param[in] stress Initial stress of the particles
+//! \param[in] dstrain Strain increment, scaled for each particle
+//! \param[in] cell Cell of the particles, with nodal velocities
+//! \param[in] dt Time step to compute strains
+//! \param[in] tolerance Relative tolerance
+template <unsigned Tdim>
+void check_batch_stresses(
+    const std::shared_ptr<mpm::Material<Tdim>>& material,
+    const typename mpm::Material<Tdim>::Vector6d& stress,
+    const typename mpm::Material<Tdim>::Vector6d& dstrain,
+    const std::shared_ptr<mpm::Cell<Tdim>>& cell, double dt,
+    double tolerance) {
+  const auto particles = batch_particles<Tdim>(cell, material, dt);
+  std::vector<const mpm::ParticleBase<Tdim>*> particle_ptrs;
+  for (const auto& particle : particles)
+    particle_ptrs.emplace_back(particle.get());
+  // Strain rates differ between the columns
+  REQUIRE((particles[0]->strain_rate() - particles[1]->strain_rate()).norm() >
+          tolerance);
+  REQUIRE((particles[1]->strain_rate() - particles[2]->strain_rate()).norm() >
+          tolerance);
+  check_batch_stresses<Tdim>(material, stress, dstrain, particle_ptrs,
+                             tolerance);
+}
+
+}  // namespace mpm_test
+
+#endif  // MPM_TEST_MATERIAL_BATCH_H_
@@ -0,0 +1,173 @@
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "checkpoint.h"
+
+//! \brief Check incremental checkpoints
+TEST_CASE("Checkpoints are checked", "[checkpoint][IO]") {
+  // Tolerance
+  const double Tolerance = 1.E-12;
+
+  // Checkpoint file of a step
+  const auto filename = [](mpm::Index step) {
+    return "checkpoint-test-" + std::to_string(step) + ".h5";
+  };
+
+  // Particle with fields derived from an id and a value
+  const auto make_particle = [](mpm::Index id, double value) {
+    mpm::HDF5Particle particle = mpm::HDF5Particle();
+    particle.id = id;
+    particle.mass = 1. + value;
+    particle.volume = 2. + value;
+    particle.pressure = 3. + value;
+    particle.coord_x = value;
+    particle.coord_y = 2. * value;
+    particle.displacement_x = 0.5 * value;
+    particle.velocity_y = -value;
+    particle.stress_xx = 10. * value;
+    particle.strain_xx = 0.1 * value;
+    particle.epsilon_v = 0.2 * value;
+    particle.cell_id = id + 100;
+    particle.status = true;
+    particle.material_id = 1;
+    particle.nstate_vars = 2;
+    particle.svars[0] = value;
+    particle.svars[1] = 3. * value;
+    return particle;
+  };
+
+  // Check that particles are equal within a tolerance
+  const auto check_particles = [&](const std::vector<mpm::HDF5Particle>& a,
+                                   const std::vector<mpm::HDF5Particle>& b,
+                                   double tolerance) {
+    REQUIRE(a.size() == b.size());
+    for (unsigned i = 0; i < a.size(); ++i) {
+      REQUIRE(a[i].id == b[i].id);
+      REQUIRE(a[i].mass == Approx(b[i].mass).margin(Tolerance));
+      REQUIRE(a[i].volume == Approx(b[i].volume).margin(Tolerance));
+      REQUIRE(a[i].coord_x == Approx(b[i].coord_x).margin(Tolerance));
+      REQUIRE(a[i].coord_y == Approx(b[i].coord_y).margin(Tolerance));
+      REQUIRE(a[i].velocity_y == Approx(b[i].velocity_y).margin(Tolerance));
+      REQUIRE(a[i].stress_xx == Approx(b[i].stress_xx).margin(Tolerance));
+      REQUIRE(a[i].svars[0] == Approx(b[i].svars[0]).margin(Tolerance));
+      REQUIRE(a[i].svars[1] == Approx(b[i].svars[1]).margin(Tolerance));
+      REQUIRE(a[i].cell_id == b[i].cell_id);
+      REQUIRE(a[i].status == b[i].status);
+      REQUIRE(a[i].material_id == b[i].material_id);
+      REQUIRE(a[i].nstate_vars == b[i].nstate_vars);
+      // Output only fields
+      REQUIRE(a[i].pressure ==
+              Approx(b[i].pressure).margin(tolerance + Tolerance));
+      REQUIRE(a[i].displacement_x ==
+              Approx(b[i].displacement_x).margin(tolerance + Tolerance));
+      REQUIRE(a[i].strain_xx ==
+              Approx(b[i].strain_xx).margin(tolerance + Tolerance));
+      REQUIRE(a[i].epsilon_v ==
+              Approx(b[i].epsilon_v).margin(tolerance + Tolerance));
+    }
+  };
+
+  SECTION("Check properties") {
+    mpm::Checkpoint checkpoint(Json::object());
+    REQUIRE(checkpoint.full_interval() == 10);
+    REQUIRE(checkpoint.tolerance() == Approx(0.).margin(Tolerance));
+
+    Json props = {{"full_interval", 0}};
+    REQUIRE_THROWS(mpm::Checkpoint(props));
+    props = {{"tolerance", -1.}};
+    REQUIRE_THROWS(mpm::Checkpoint(props));
+  }
+
+  SECTION("Check full and delta checkpoints") {
+    const double tolerance = 0.1;
+    Json props = {{"full_interval", 3}, {"tolerance", tolerance}};
+    mpm::Checkpoint checkpoint(props);
+
+    std::vector<std::vector<mpm::HDF5Particle>> steps;
+    // Step 0
+    steps.push_back({make_particle(0, 1.), make_particle(1, 2.),
+                     make_particle(2, 3.)});
+    // Step 1: one particle moves, output only fields change within the
+    // tolerance
+    steps.push_back(steps.back());
+    steps.back()[1].coord_x += 1.;
+    steps.back()[1].svars[0] += 1.;
+    steps.back()[2].pressure += 0.05;
+    steps.back()[2].displacement_x += 0.05;
+    // Step 2: a particle is removed, a particle is added, particles are
+    // reordered and output only fields drift further
+    steps.push_back({steps.back()[2], make_particle(5, 7.), steps.back()[0]});
+    steps.back()[0].pressure += 0.07;
+    steps.back()[0].displacement_x += 0.08;
+    steps.back()[2].cell_id = 200;
+    steps.back()[2].status = false;
+    // Step 3: full snapshot
+    steps.push_back(steps.back());
+    steps.back()[1].stress_xx = -5.;
+
+    const std::vector<bool> full{true, false, false, true};
+    for (unsigned step = 0; step < steps.size(); ++step)
+      REQUIRE(checkpoint.write(filename(step), step, steps[step]) ==
+              full[step]);
+
+    // Delta snapshots only store changed fields
+    hid_t file_id = H5Fopen(filename(1).c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    REQUIRE(file_id >= 0);
+    REQUIRE(H5LTfind_dataset(file_id, "ids") == 0);
+    REQUIRE(H5LTfind_dataset(file_id, "coordinates") == 1);
+    REQUIRE(H5LTfind_dataset(file_id, "coordinates_index") == 1);
+    REQUIRE(H5LTfind_dataset(file_id, "pressure") == 0);
+    REQUIRE(H5LTfind_dataset(file_id, "svars") == 1);
+    REQUIRE(H5LTfind_dataset(file_id, "state") == 0);
+    hsize_t dims[2] = {0, 0};
+    H5LTget_dataset_info(file_id, "coordinates", dims, nullptr, nullptr);
+    REQUIRE(dims[0] == 1);
+    REQUIRE(dims[1] == 3);
+    H5Fclose(file_id);
+
+    file_id = H5Fopen(filename(2).c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    REQUIRE(file_id >= 0);
+    REQUIRE(H5LTfind_dataset(file_id, "ids") == 1);
+    REQUIRE(H5LTfind_dataset(file_id, "state") == 1);
+    REQUIRE(H5LTfind_dataset(file_id, "state_index") == 1);
+    H5Fclose(file_id);
+
+    // Full snapshots of the checkpoints
+    REQUIRE(mpm::Checkpoint::full_step(filename, 0) == 0);
+    REQUIRE(mpm::Checkpoint::full_step(filename, 2) == 0);
+    REQUIRE(mpm::Checkpoint::full_step(filename, 3) == 3);
+
+    // Reconstruct every step
+    for (unsigned step = 0; step < steps.size(); ++step)
+      check_particles(mpm::Checkpoint::read(filename, step), steps[step],
+                      tolerance);
+
+    // Changes within the tolerance are not stored
+    auto particles = mpm::Checkpoint::read(filename, 1);
+    REQUIRE(particles[2].pressure == Approx(6.).margin(Tolerance));
+    // Accumulated changes beyond the tolerance are stored
+    particles = mpm::Checkpoint::read(filename, 2);
+    REQUIRE(particles[0].pressure == Approx(6.12).margin(Tolerance));
+    REQUIRE(particles[0].displacement_x == Approx(1.63).margin(Tolerance));
+
+    // Missing checkpoint
+    REQUIRE_THROWS(mpm::Checkpoint::read(filename, 20));
+    REQUIRE_THROWS(mpm::Checkpoint::full_step(filename, 20));
+  }
+
+  SECTION("Check lossless checkpoints") {
+    mpm::Checkpoint checkpoint(Json::object());
+    std::vector<mpm::HDF5Particle> particles{make_particle(3, 1.),
+                                             make_particle(4, 2.)};
+    REQUIRE(checkpoint.write(filename(0), 0, particles) == true);
+    particles[0].pressure += 1.E-9;
+    REQUIRE(checkpoint.write(filename(5), 5, particles) == false);
+    // Unchanged particles
+    REQUIRE(checkpoint.write(filename(10), 10, particles) == false);
+
+    check_particles(mpm::Checkpoint::read(filename, 5), particles, 0.);
+    check_particles(mpm::Checkpoint::read(filename, 10), particles, 0.);
+  }
+}
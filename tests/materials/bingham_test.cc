@@ -9,6 +9,7 @@
 #include "factory.h"
 #include "hexahedron_element.h"
 #include "material.h"
+#include "material_batch.h"
 #include "mesh.h"
 #include "node.h"
 
@@ -352,6 +353,10 @@ TEST_CASE("Bingham is checked in 2D", "[material][bingham][2D]") {
     REQUIRE(check_stress(4) == Approx(0.000e+00).epsilon(Tolerance));
     REQUIRE(check_stress(5) == Approx(0.000e+00).epsilon(Tolerance));
 
+    // Check batch stress update
+    mpm_test::check_batch_stresses<Dim>(material, stress, dstrain, cell, dt,
+                                        Tolerance);
+
     // Calculate modulus values
     const double K = 1.0E+7 / (3.0 * (1. - 2. * 0.3));
     const double volumetric_strain = -0.625;
@@ -843,6 +848,10 @@ TEST_CASE("Bingham is checked in 3D", "[material][bingham][3D]") {
     REQUIRE(check_stress(4) == Approx(-19.9651684068).epsilon(Tolerance));
     REQUIRE(check_stress(5) == Approx(-199.6516840678).epsilon(Tolerance));
 
+    // Check batch stress update
+    mpm_test::check_batch_stresses<Dim>(material, stress, dstrain, cell, dt,
+                                        Tolerance);
+
     // Calculate modulus values
     const double K = 1.0E+7 / (3.0 * (1. - 2. * 0.3));
     // Calculate pressure
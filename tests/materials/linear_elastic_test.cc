@@ -6,6 +6,7 @@
 
 #include "cell.h"
 #include "material.h"
+#include "material_batch.h"
 #include "node.h"
 #include "particle.h"
 
@@ -146,6 +147,11 @@ TEST_CASE("LinearElastic is checked in 2D", "[material][linear_elastic][2D]") {
     REQUIRE(stress(3) == Approx(3.84615384615385e+01).epsilon(Tolerance));
     REQUIRE(stress(4) == Approx(0.00000000000000e+00).epsilon(Tolerance));
     REQUIRE(stress(5) == Approx(0.00000000000000e+00).epsilon(Tolerance));
+
+    // Check batch stress update
+    mpm_test::check_batch_stresses<Dim>(
+        material, mpm::Material<Dim>::Vector6d::Zero(), strain, particle.get(),
+        Tolerance);
   }
 }
 
@@ -288,5 +294,10 @@ TEST_CASE("LinearElastic is checked in 3D", "[material][linear_elastic][3D]") {
     REQUIRE(stress(3) == Approx(3.84615384615385e+01).epsilon(Tolerance));
     REQUIRE(stress(4) == Approx(7.69230769230769e+01).epsilon(Tolerance));
     REQUIRE(stress(5) == Approx(1.15384615384615e+02).epsilon(Tolerance));
+
+    // Check batch stress update
+    mpm_test::check_batch_stresses<Dim>(
+        material, mpm::Material<Dim>::Vector6d::Zero(), strain, particle.get(),
+        Tolerance);
   }
 }
@@ -243,6 +243,89 @@ TEST_CASE("Modified cam clay undrained condition is checked in 3D",
     // Check pc
     REQUIRE(state_vars.at("pc") ==
             Approx(200368.9146817101).epsilon(Tolerance));
+
+    // Check return mapping statistics
+    auto statistics = material->statistics();
+    REQUIRE(statistics.at("nupdates") == 1);
+    REQUIRE(statistics.at("niterations") > 0);
+    REQUIRE(statistics.at("nsubsteps") == 0);
+    REQUIRE(statistics.at("nnonconverged") == 0);
+    material->reset_statistics();
+    REQUIRE(material->statistics().at("nupdates") == 0);
+    REQUIRE(material->statistics().at("niterations") == 0);
+
+    // Trial stresses of implicit iterations are not counted
+    state_vars = material->initialise_state_variables();
+    material->compute_trial_stress(stress, dstrain, particle.get(),
+                                   &state_vars);
+    REQUIRE(material->statistics().at("nupdates") == 0);
+
+    // Statistics of a batch are added once for all the particles
+    mpm::Material<Dim>::Matrix6X stresses(6, 2);
+    mpm::Material<Dim>::Matrix6X dstrains(6, 2);
+    stresses.col(0) = stress;
+    stresses.col(1) = stress;
+    dstrains.col(0) = dstrain;
+    dstrains.col(1) = dstrain;
+    mpm::dense_map batch_state_vars = material->initialise_state_variables();
+    material->compute_stresses(
+        &stresses, dstrains, {particle.get(), particle.get()},
+        {&state_vars, &batch_state_vars});
+    REQUIRE(material->statistics().at("nupdates") == 2);
+  }
+
+  //! Check compute stress in plastic status with sub-stepping
+  SECTION("CamClay check stresses in plastic status with sub-stepping") {
+
+    jmaterial["pc0"] = 200000;
+    jmaterial["ocr"] = 1.;
+    jmaterial["ftolerance"] = 1.E-5;
+    jmaterial["max_iterations"] = 1;
+    jmaterial["max_substeps"] = 8;
+
+    unsigned id = 0;
+    auto material =
+        Factory<mpm::Material<Dim>, unsigned, const Json&>::instance()->create(
+            "ModifiedCamClay3D", std::move(id), jmaterial);
+
+    REQUIRE(material->id() == 0);
+
+    // Initialise stress
+    mpm::Material<Dim>::Vector6d stress;
+    stress.setZero();
+    stress(0) = -200000;
+    stress(1) = -200000;
+    stress(2) = -200000;
+
+    mpm::dense_map state_vars = material->initialise_state_variables();
+
+    // Initialise strain
+    mpm::Material<Dim>::Vector6d dstrain;
+    dstrain.setZero();
+    dstrain(0) = 0.00050000;
+    dstrain(1) = 0.00050000;
+    dstrain(2) = -0.00100000;
+
+    // Compute stress
+    stress =
+        material->compute_stress(stress, dstrain, particle.get(), &state_vars);
+
+    // Check stresses remain close to the single step solution
+    const double SubstepTolerance = 1.E-2;
+    REQUIRE(stress(0) ==
+            Approx(-192882.4825752268).epsilon(SubstepTolerance));
+    REQUIRE(stress(1) ==
+            Approx(-192882.4825752268).epsilon(SubstepTolerance));
+    REQUIRE(stress(2) ==
+            Approx(-211655.0108685302).epsilon(SubstepTolerance));
+    REQUIRE(stress(3) == Approx(0.000000).epsilon(Tolerance));
+    REQUIRE(stress(4) == Approx(0.000000).epsilon(Tolerance));
+    REQUIRE(stress(5) == Approx(0.000000).epsilon(Tolerance));
+
+    // Check that the increment was sub-stepped
+    auto statistics = material->statistics();
+    REQUIRE(statistics.at("nupdates") == 1);
+    REQUIRE(statistics.at("nsubsteps") > 0);
   }
 
   //! Check compute stress in plastic status with bonded properties
@@ -8,6 +8,7 @@
 
 #include "cell.h"
 #include "material.h"
+#include "material_batch.h"
 #include "mohr_coulomb.h"
 #include "node.h"
 #include "particle.h"
@@ -301,6 +302,10 @@ TEST_CASE("MohrCoulomb is checked in 2D (cohesion only, without softening)",
       REQUIRE(updated_stress(3) == Approx(-572.6747219618).epsilon(Tolerance));
       REQUIRE(updated_stress(4) == Approx(0.).epsilon(Tolerance));
       REQUIRE(updated_stress(5) == Approx(0.).epsilon(Tolerance));
+
+      // Check batch stress update
+      mpm_test::check_batch_stresses<Dim>(material, stress, dstrain,
+                                          particle.get(), Tolerance);
     }
 
     //! Check for tensile failure
@@ -380,6 +385,10 @@ TEST_CASE("MohrCoulomb is checked in 2D (cohesion only, without softening)",
       REQUIRE(updated_stress(3) == Approx(-378.1586271491).epsilon(Tolerance));
       REQUIRE(updated_stress(4) == Approx(0.).epsilon(Tolerance));
       REQUIRE(updated_stress(5) == Approx(0.).epsilon(Tolerance));
+
+      // Check batch stress update
+      mpm_test::check_batch_stresses<Dim>(material, stress, dstrain,
+                                          particle.get(), Tolerance);
     }
   }
 
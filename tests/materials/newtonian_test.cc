@@ -9,6 +9,7 @@
 #include "factory.h"
 #include "hexahedron_element.h"
 #include "material.h"
+#include "material_batch.h"
 #include "mesh.h"
 #include "node.h"
 
@@ -162,6 +163,10 @@ TEST_CASE("Newtonian is checked in 2D", "[material][newtonian][2D]") {
     REQUIRE(check_stress(4) == Approx(0.000e+00).epsilon(Tolerance));
     REQUIRE(check_stress(5) == Approx(0.000e+00).epsilon(Tolerance));
 
+    // Check batch stress update
+    mpm_test::check_batch_stresses<Dim>(material, stress, dstrain, cell, dt,
+                                        Tolerance);
+
     // Calculate modulus values
     const double K = 8333333.333333333;
     // Calculate pressure
@@ -428,6 +433,10 @@ TEST_CASE("Newtonian is checked in 3D", "[material][newtonian][3D]") {
     REQUIRE(check_stress(4) == Approx(-0.0000003129).epsilon(Tolerance));
     REQUIRE(check_stress(5) == Approx(-0.0000031289).epsilon(Tolerance));
 
+    // Check batch stress update
+    mpm_test::check_batch_stresses<Dim>(material, stress, dstrain, cell, dt,
+                                        Tolerance);
+
     // Calculate modulus values
     const double K = 8333333.333333333;
     // Calculate pressure
@@ -283,6 +283,60 @@ TEST_CASE("NorSand is checked in 3D non-bonded model",
     REQUIRE(state_vars.at("plastic_strain3") == Approx(0.0).epsilon(Tolerance));
     REQUIRE(state_vars.at("plastic_strain4") == Approx(0.0).epsilon(Tolerance));
     REQUIRE(state_vars.at("plastic_strain5") == Approx(0.0).epsilon(Tolerance));
+
+    // Check statistics
+    REQUIRE(material->statistics().at("nupdates") == 2);
+    REQUIRE(material->statistics().at("nsubsteps") == 0);
+  }
+
+  SECTION("NorSand check undrained stresses with sub-stepping") {
+    jmaterial["max_substeps"] = 64;
+    jmaterial["substep_tolerance"] = 1.E-4;
+
+    unsigned id = 0;
+    auto material =
+        Factory<mpm::Material<Dim>, unsigned, const Json&>::instance()->create(
+            "NorSand3D", std::move(id), jmaterial);
+    REQUIRE(material->id() == 0);
+
+    // Initialise stress
+    mpm::Material<Dim>::Vector6d stress;
+    stress.setZero();
+    stress(0) = -200000;
+    stress(1) = -200000;
+    stress(2) = -200000;
+
+    // Initialise dstrain
+    mpm::Material<Dim>::Vector6d dstrain;
+    dstrain.setZero();
+    dstrain(0) = -0.010000;
+    dstrain(1) = 0.005000;
+    dstrain(2) = 0.005000;
+
+    // Compute updated stress two times to get yielding
+    mpm::dense_map state_vars = material->initialise_state_variables();
+    stress =
+        material->compute_stress(stress, dstrain, particle.get(), &state_vars);
+    stress =
+        material->compute_stress(stress, dstrain, particle.get(), &state_vars);
+
+    // Check stresses are finite, compressive and axisymmetric
+    for (unsigned i = 0; i < 3; ++i) {
+      REQUIRE(std::isfinite(stress(i)));
+      REQUIRE(stress(i) < 0.);
+    }
+    REQUIRE(stress(1) == Approx(stress(2)).epsilon(Tolerance));
+    REQUIRE(stress(0) < stress(1));
+    REQUIRE(stress(3) == Approx(0.000000).epsilon(Tolerance));
+    REQUIRE(stress(4) == Approx(0.000000).epsilon(Tolerance));
+    REQUIRE(stress(5) == Approx(0.000000).epsilon(Tolerance));
+    REQUIRE(state_vars.at("pdstrain") > 0.);
+
+    // Check that the increments were sub-stepped
+    auto statistics = material->statistics();
+    REQUIRE(statistics.at("nupdates") == 2);
+    REQUIRE(statistics.at("nsubsteps") >= 2);
+    REQUIRE(statistics.at("niterations") >= statistics.at("nsubsteps"));
   }
 }
 
@@ -468,6 +468,11 @@ TEST_CASE("Mesh cell neighbours 2D", "[MeshCell][2D][mpi]") {
             REQUIRE(cell6->particles() == p6);
           }
 
+          // Number of particles in cells is known on all ranks
+          mesh->find_nglobal_particles_cells();
+          REQUIRE(cell2->nglobal_particles() == 2);
+          REQUIRE(cell6->nglobal_particles() == 2);
+
           // Find particle neighbours
           mesh->find_particle_neighbours();
 
@@ -543,6 +548,21 @@ TEST_CASE("Mesh cell neighbours 2D", "[MeshCell][2D][mpi]") {
             REQUIRE(particle9->neighbours() == np9);
             REQUIRE(particle10->neighbours() == np10);
             REQUIRE(particle11->neighbours() == np11);
+
+            // Cell list of cell 2 has the particles of all cells as ranges
+            const auto& cell_list = mesh->cell_list();
+            REQUIRE(cell_list.nneighbours(2) == 18);
+            REQUIRE(cell_list.neighbour_ranges(2).size() == 9);
+            std::vector<mpm::Index> cell2_particles;
+            cell_list.iterate_over_neighbours(2, [&](mpm::Index pid) {
+              if (pid != 8) cell2_particles.emplace_back(pid);
+            });
+            REQUIRE(cell2_particles == np8);
+
+            // Particles read neighbour ranges from the shared cell list
+            REQUIRE(particle8->neighbour_ranges().size() == 9);
+            REQUIRE(particle8->neighbour_ranges().front().begin() ==
+                    cell_list.particles(2).begin());
           }
           if (mpi_rank == 2) {
             REQUIRE(particle12->neighbours() == np12);
@@ -1,6 +1,7 @@
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <set>
 
 #include <Eigen/Dense>
 #include <boost/filesystem.hpp>
@@ -617,6 +618,91 @@ TEST_CASE("Mesh is checked for 2D case", "[mesh][2D]") {
         REQUIRE_NOTHROW(mesh->inject_particles(0.15));
         // Number of particles
         REQUIRE(mesh->nparticles() == 4);
+
+        // Ids of repeated injections are unique
+        std::set<mpm::Index> ids;
+        for (unsigned i = 0; i < 2; ++i) {
+          std::vector<mpm::Index> pids;
+          for (const auto& particle : mesh->particles_hdf5()) {
+            pids.emplace_back(particle.id);
+            ids.insert(particle.id);
+          }
+          REQUIRE(pids.size() == 4);
+          mesh->remove_particles(pids);
+          REQUIRE(mesh->nparticles() == 0);
+          REQUIRE_NOTHROW(mesh->inject_particles(0.16));
+          REQUIRE(mesh->nparticles() == 4);
+        }
+        for (const auto& particle : mesh->particles_hdf5())
+          ids.insert(particle.id);
+        REQUIRE(ids.size() == 12);
+      }
+
+      SECTION("Check injected particle ids across ranks") {
+        // Ids of ranks injecting different numbers of particles in repeated
+        // injections
+        const mpm::Index offset = 10;
+        const int mpi_size = 3;
+        const std::vector<std::vector<mpm::Index>> nparticles{
+            {4, 0, 2}, {1, 3, 0}, {2, 2, 5}};
+        std::vector<mpm::Index> counters(mpi_size, 0);
+        std::set<mpm::Index> ids;
+        mpm::Index nids = 0;
+        for (const auto& injection : nparticles) {
+          for (int rank = 0; rank < mpi_size; ++rank) {
+            for (mpm::Index index = 0; index < injection[rank]; ++index) {
+              const mpm::Index id = mpm::Mesh<Dim>::injected_particle_id(
+                  offset, counters[rank], index, rank, mpi_size);
+              REQUIRE(id >= offset);
+              REQUIRE(id % mpi_size == (offset + rank) % mpi_size);
+              ids.insert(id);
+              ++nids;
+            }
+            counters[rank] += injection[rank];
+          }
+        }
+        REQUIRE(ids.size() == nids);
+      }
+
+      SECTION("Inject points with flow rate") {
+        // Gauss point generation
+        Json jgen;
+        jgen["type"] = "inject";
+        jgen["material_id"] = {0};
+        jgen["cset_id"] = 1;
+        jgen["particle_type"] = "P2D";
+        jgen["check_duplicates"] = false;
+        jgen["nparticles_per_dir"] = 2;
+        jgen["velocity"] = {0., 0.};
+        jgen["duration"] = {0.1, 1.0};
+        jgen["flow_rate"] = 10.;
+
+        // Generate
+        REQUIRE(mesh->generate_particles(io, jgen) == true);
+        // Injected volume is less than the cell volume
+        REQUIRE_NOTHROW(mesh->inject_particles(0.15));
+        REQUIRE(mesh->nparticles() == 0);
+        // Injected volume exceeds the cell volume
+        REQUIRE_NOTHROW(mesh->inject_particles(0.6));
+        REQUIRE(mesh->nparticles() == 4);
+        // Cell is not empty
+        REQUIRE_NOTHROW(mesh->inject_particles(0.9));
+        REQUIRE(mesh->nparticles() == 4);
+        // Injected volume is the volume of the particles created
+        std::vector<mpm::Index> pids;
+        double volume = 0.;
+        for (const auto& particle : mesh->particles_hdf5()) {
+          pids.emplace_back(particle.id);
+          volume += particle.volume;
+        }
+        REQUIRE(volume == Approx(4.).epsilon(Tolerance));
+        mesh->remove_particles(pids);
+        // Remaining volume 7.6 - 4 is less than the cell volume
+        REQUIRE_NOTHROW(mesh->inject_particles(0.86));
+        REQUIRE(mesh->nparticles() == 0);
+        // Remaining volume 8.4 - 4 exceeds the cell volume
+        REQUIRE_NOTHROW(mesh->inject_particles(0.94));
+        REQUIRE(mesh->nparticles() == 4);
       }
     }
 
@@ -648,6 +734,69 @@ TEST_CASE("Mesh is checked for 2D case", "[mesh][2D]") {
     REQUIRE(particle1->cell_id() == 0);
     // Check location of particle 2
     REQUIRE(particle2->cell_id() == 0);
+
+    // Compute shape functions in the shape function cache
+    REQUIRE_NOTHROW(mesh->compute_shapefn());
+    auto cache = mesh->shapefn_cache();
+    REQUIRE(cache->nparticles() == mesh->nparticles());
+    REQUIRE(cache->nfunctions() == 4);
+    for (mpm::Index i = 0; i < cache->nparticles(); ++i) {
+      // Partition of unity of shape functions and their gradients
+      double sum_shapefn = 0.;
+      Eigen::Matrix<double, Dim, 1> sum_dn_dx;
+      sum_dn_dx.setZero();
+      for (unsigned j = 0; j < cache->nfunctions(); ++j) {
+        sum_shapefn += cache->shapefn(i)[j];
+        for (unsigned k = 0; k < Dim; ++k)
+          sum_dn_dx(k) += cache->dn_dx(i)[k * cache->nfunctions() + j];
+      }
+      REQUIRE(sum_shapefn == Approx(1.).epsilon(Tolerance));
+      for (unsigned k = 0; k < Dim; ++k)
+        REQUIRE(sum_dn_dx(k) == Approx(0.).margin(Tolerance));
+    }
+
+    // Slots are invalidated when particles are removed and reassigned in
+    // the next pass
+    REQUIRE(mesh->remove_particle(particle2) == true);
+    REQUIRE(cache->nparticles() == 0);
+    REQUIRE_NOTHROW(particle1->compute_shapefn());
+    REQUIRE(mesh->add_particle(particle2) == true);
+    REQUIRE_NOTHROW(mesh->compute_shapefn());
+    REQUIRE(cache->nparticles() == mesh->nparticles());
+
+    // Stresses of particles without a material are not updated
+    REQUIRE_THROWS(mesh->compute_particle_stresses());
+
+    // Critical time step of particles at rest without wave speeds
+    std::map<unsigned, double> wave_speeds;
+    REQUIRE(mesh->critical_time_step(wave_speeds) ==
+            std::numeric_limits<double>::max());
+
+    // Critical time step with particle velocity
+    Eigen::Matrix<double, Dim, 1> velocity;
+    velocity << 3., 4.;
+    REQUIRE(particle1->assign_velocity(velocity) == true);
+    REQUIRE(mesh->critical_time_step(wave_speeds) ==
+            Approx(cell1->mean_length() / 5.).epsilon(Tolerance));
+
+    // Critical time step with wave speed and particle velocity
+    wave_speeds[particle1->material_id()] = 5.;
+    REQUIRE(mesh->critical_time_step(wave_speeds) ==
+            Approx(cell1->mean_length() / 10.).epsilon(Tolerance));
+
+    // Initialise and activate nodes of the step
+    mesh->initialise_step_nodes();
+    REQUIRE(node0->status() == true);
+    REQUIRE(node2->status() == true);
+    node0->update_mass(true, 0, 2.);
+    REQUIRE(node0->mass(0) == Approx(2.).epsilon(Tolerance));
+    // Nodes of the previous step are reset
+    mesh->initialise_step_nodes();
+    REQUIRE(node0->mass(0) == Approx(0.).margin(Tolerance));
+    REQUIRE(node0->status() == true);
+
+    // No particle injections
+    REQUIRE(mesh->injection_active(0.) == false);
   }
 
   //! Check create nodes and cells in a mesh
@@ -778,6 +927,31 @@ TEST_CASE("Mesh is checked for 2D case", "[mesh][2D]") {
           // Initialise material models in mesh
           mesh->initialise_material_models(materials);
 
+          SECTION("Check NUMA-aware creation of particles") {
+            mesh->numa_aware(true);
+            REQUIRE(mesh->numa_aware() == true);
+            // Particle type 2D
+            const std::string particle_type = "P2D";
+            REQUIRE(mesh->create_particles(particle_type, coordinates, mids, 0,
+                                           false) == true);
+            REQUIRE(mesh->nparticles() == coordinates.size());
+            // Particles are placed in the pools of threads
+            REQUIRE(mesh->particle_pool()->nallocated() == 0);
+            // Particle ids and coordinates follow the list of coordinates
+            const auto hdf5_particles = mesh->particles_hdf5();
+            for (unsigned i = 0; i < hdf5_particles.size(); ++i) {
+              REQUIRE(hdf5_particles[i].id == i);
+              REQUIRE(hdf5_particles[i].coord_x ==
+                      Approx(coordinates[i](0)).epsilon(Tolerance));
+              REQUIRE(hdf5_particles[i].coord_y ==
+                      Approx(coordinates[i](1)).epsilon(Tolerance));
+            }
+            // Invalid particle type
+            REQUIRE(mesh->create_particles("P2DINVALID", coordinates, mids, 1,
+                                           false) == false);
+            mesh->numa_aware(false);
+          }
+
           SECTION("Check addition of particles to mesh") {
             // Particle type 2D
             const std::string particle_type = "P2D";
@@ -911,6 +1085,103 @@ TEST_CASE("Mesh is checked for 2D case", "[mesh][2D]") {
               auto phdf5 = mesh->particles_hdf5();
               REQUIRE(phdf5.size() == mesh->nparticles());
 
+              // Check compact table
+              hid_t file_id =
+                  H5Fopen("particles-2d.h5", H5F_ACC_RDONLY, H5P_DEFAULT);
+              hsize_t nfields = 0, nrecords = 0;
+              H5TBget_table_info(file_id, "table", &nfields, &nrecords);
+              H5Fclose(file_id);
+              REQUIRE(nrecords == mesh->nparticles());
+              REQUIRE(nfields < mpm::hdf5::particle::NFIELDS);
+              mpm::hdf5::particle::CompactLayout layout(Dim, 0);
+              REQUIRE(nfields == layout.nfields());
+              REQUIRE(layout.record_size() * 2 <
+                      mpm::hdf5::particle::dst_size);
+
+              // Read compact table
+              REQUIRE(mesh->read_particles_hdf5(0, "particles-2d.h5") == true);
+              REQUIRE(mesh->nparticles() == phdf5.size());
+              auto rhdf5 = mesh->particles_hdf5();
+              for (unsigned i = 0; i < phdf5.size(); ++i) {
+                REQUIRE(rhdf5[i].id == phdf5[i].id);
+                REQUIRE(rhdf5[i].coord_x ==
+                        Approx(phdf5[i].coord_x).epsilon(Tolerance));
+                REQUIRE(rhdf5[i].coord_y ==
+                        Approx(phdf5[i].coord_y).epsilon(Tolerance));
+                REQUIRE(rhdf5[i].material_id == phdf5[i].material_id);
+              }
+
+              // Single precision table against the double precision table
+              REQUIRE(mesh->write_particles_hdf5(0, "particles-2d-single.h5",
+                                                 true) == true);
+              mpm::hdf5::particle::CompactLayout single_layout(Dim, 0, true);
+              REQUIRE(single_layout.nfields() == layout.nfields());
+              REQUIRE(single_layout.real_size() == sizeof(float));
+              REQUIRE(single_layout.record_size() < layout.record_size());
+              REQUIRE(mesh->read_particles_hdf5(0, "particles-2d-single.h5") ==
+                      true);
+              rhdf5 = mesh->particles_hdf5();
+              REQUIRE(rhdf5.size() == phdf5.size());
+              for (unsigned i = 0; i < phdf5.size(); ++i) {
+                REQUIRE(rhdf5[i].id == phdf5[i].id);
+                REQUIRE(rhdf5[i].coord_x ==
+                        Approx(phdf5[i].coord_x).epsilon(1.E-6));
+                REQUIRE(rhdf5[i].coord_y ==
+                        Approx(phdf5[i].coord_y).epsilon(1.E-6));
+                REQUIRE(rhdf5[i].mass == Approx(phdf5[i].mass).epsilon(1.E-6));
+                REQUIRE(rhdf5[i].material_id == phdf5[i].material_id);
+              }
+
+              // Read table with all fields
+              file_id = H5Fcreate("particles-2d-full.h5", H5F_ACC_TRUNC,
+                                  H5P_DEFAULT, H5P_DEFAULT);
+              H5TBmake_table("Table Title", file_id, "table",
+                             mpm::hdf5::particle::NFIELDS, phdf5.size(),
+                             mpm::hdf5::particle::dst_size,
+                             mpm::hdf5::particle::field_names,
+                             mpm::hdf5::particle::dst_offset,
+                             mpm::hdf5::particle::field_type, 10000, NULL, 0,
+                             phdf5.data());
+              H5Fclose(file_id);
+              REQUIRE(mesh->read_particles_hdf5(0, "particles-2d-full.h5") ==
+                      true);
+              rhdf5 = mesh->particles_hdf5();
+              REQUIRE(rhdf5.size() == phdf5.size());
+              for (unsigned i = 0; i < phdf5.size(); ++i) {
+                REQUIRE(rhdf5[i].id == phdf5[i].id);
+                REQUIRE(rhdf5[i].coord_x ==
+                        Approx(phdf5[i].coord_x).epsilon(Tolerance));
+              }
+
+              // Table without cells is not restored
+              std::vector<std::shared_ptr<mpm::ParticleBase<Dim>>>
+                  unlocatable;
+              REQUIRE(mesh->read_particles_cells_hdf5("particles-2d-full.h5",
+                                                      &unlocatable) == false);
+
+              // Restore particles of cells
+              REQUIRE(mesh->locate_particles_mesh().size() == 0);
+              auto cells = mesh->cells();
+              std::vector<std::vector<mpm::Index>> cell_particles;
+              for (auto citr = cells.cbegin(); citr != cells.cend(); ++citr)
+                cell_particles.emplace_back((*citr)->particles());
+              REQUIRE(mesh->write_particles_hdf5(0, "particles-2d-cells.h5") ==
+                      true);
+              REQUIRE(mesh->read_particles_cells_hdf5("particles-2d-cells.h5",
+                                                      &unlocatable) == false);
+              REQUIRE(mesh->write_particles_cells_hdf5(
+                          "particles-2d-cells.h5") == true);
+              REQUIRE(mesh->read_particles_hdf5(0, "particles-2d-cells.h5") ==
+                      true);
+              REQUIRE(mesh->read_particles_cells_hdf5("particles-2d-cells.h5",
+                                                      &unlocatable) == true);
+              REQUIRE(unlocatable.size() == 0);
+              unsigned c = 0;
+              for (auto citr = cells.cbegin(); citr != cells.cend(); ++citr) {
+                REQUIRE((*citr)->particles() == cell_particles[c]);
+                ++c;
+              }
+
 #ifdef USE_PARTIO
               REQUIRE_NOTHROW(mpm::partio::write_particles(
                   "partio-2d.bgeo", mesh->particles_hdf5()));
@@ -952,6 +1223,17 @@ TEST_CASE("Mesh is checked for 2D case", "[mesh][2D]") {
 
               REQUIRE(mesh->nparticles() == 8);
 
+              // Iterate over particles of a set
+              Eigen::Matrix<double, Dim, 1> velocity;
+              velocity << 1., 2.;
+              mesh->iterate_over_particle_set(
+                  1, std::bind(&mpm::ParticleBase<Dim>::assign_velocity,
+                               std::placeholders::_1, velocity));
+              auto velocities = mesh->particles_vector_data("velocities");
+              REQUIRE(velocities.size() == 8);
+              REQUIRE(velocities.at(1)(1) == Approx(2.).epsilon(Tolerance));
+              REQUIRE(velocities.at(0)(1) == Approx(0.).margin(Tolerance));
+
               REQUIRE(mesh->create_particles_tractions(mfunction, 0, 0, 10.5) ==
                       true);
               REQUIRE(mesh->create_particles_tractions(mfunction, 1, 1,
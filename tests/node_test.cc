@@ -924,6 +924,53 @@ TEST_CASE("Node is checked for 2D case", "[node][2D]") {
       REQUIRE(node->compute_acceleration_velocity(Nphase, dt) == false);
     }
 
+    SECTION("Check viscous damping and unbalanced force") {
+      // Time step
+      const double dt = 0.1;
+      // Nodal mass
+      const double mass = 100.;
+      REQUIRE_NOTHROW(node->update_mass(false, Nphase, mass));
+
+      // Velocity of 1 from momentum
+      Eigen::Matrix<double, Dim, 1> momentum;
+      momentum << 100., 100.;
+      REQUIRE_NOTHROW(node->update_momentum(false, Nphase, momentum));
+      REQUIRE_NOTHROW(node->compute_velocity());
+
+      // Unbalanced force of 10 and 20
+      Eigen::Matrix<double, Dim, 1> force;
+      force << 4., 8.;
+      REQUIRE_NOTHROW(node->update_external_force(false, Nphase, force));
+      force << 6., 12.;
+      REQUIRE_NOTHROW(node->update_internal_force(false, Nphase, force));
+      REQUIRE(node->unbalanced_force(Nphase)(0) ==
+              Approx(10.).epsilon(Tolerance));
+      REQUIRE(node->unbalanced_force(Nphase)(1) ==
+              Approx(20.).epsilon(Tolerance));
+
+      // Acceleration = force / (2 * mass) - 0.5 * velocity
+      REQUIRE(node->compute_acceleration_velocity_viscous(Nphase, dt, 0.5,
+                                                          2.) == true);
+      REQUIRE(node->acceleration(Nphase)(0) ==
+              Approx(-0.45).epsilon(Tolerance));
+      REQUIRE(node->acceleration(Nphase)(1) ==
+              Approx(-0.4).epsilon(Tolerance));
+      REQUIRE(node->velocity(Nphase)(0) == Approx(0.955).epsilon(Tolerance));
+      REQUIRE(node->velocity(Nphase)(1) == Approx(0.96).epsilon(Tolerance));
+
+      // Constrained directions carry no unbalanced force
+      REQUIRE(node->assign_velocity_constraint(0, 0.) == true);
+      REQUIRE(node->unbalanced_force(Nphase)(0) ==
+              Approx(0.).epsilon(Tolerance));
+      REQUIRE(node->unbalanced_force(Nphase)(1) ==
+              Approx(20.).epsilon(Tolerance));
+
+      // Cleared constraints free all directions
+      REQUIRE_NOTHROW(node->clear_constraints());
+      REQUIRE(node->unbalanced_force(Nphase)(0) ==
+              Approx(10.).epsilon(Tolerance));
+    }
+
     SECTION("Check momentum, velocity and acceleration") {
       // Time step
       const double dt = 0.1;
@@ -1056,6 +1103,16 @@ TEST_CASE("Node is checked for 2D case", "[node][2D]") {
         // Check that the acceleration is 0 in local coordinate
         REQUIRE((inverse_rotation_matrix * node->acceleration(Nphase))(0) ==
                 Approx(0).epsilon(Tolerance));
+
+        // Cleared constraints remove the rotation matrix
+        node->clear_constraints();
+        REQUIRE(node->assign_velocity_constraint(0, -12.5) == true);
+        node->apply_velocity_constraints();
+        REQUIRE(node->velocity(Nphase)(0) == Approx(-12.5).epsilon(Tolerance));
+        REQUIRE(node->velocity(Nphase)(1) ==
+                Approx(velocity(1)).epsilon(Tolerance));
+        REQUIRE(node->acceleration(Nphase)(0) ==
+                Approx(0.).epsilon(Tolerance));
       }
 
       SECTION("Check general velocity constraints in all directions") {
@@ -137,6 +137,17 @@ TEST_CASE("Particle is checked for 1D case", "[particle][1D]") {
     // Check scalar data: invalid
     REQUIRE(std::isnan(particle->scalar_data("invalid")) == true);
 
+    // Check attribute registry
+    auto mass_accessor = mpm::ParticleBase<Dim>::scalar_accessor("mass");
+    REQUIRE(mass_accessor != nullptr);
+    REQUIRE((particle.get()->*mass_accessor)() ==
+            Approx(100.5).epsilon(Tolerance));
+    REQUIRE(mpm::ParticleBase<Dim>::scalar_accessor("invalid") == nullptr);
+    REQUIRE(mpm::ParticleBase<Dim>::vector_accessor("velocities") != nullptr);
+    REQUIRE(mpm::ParticleBase<Dim>::vector_accessor("invalid") == nullptr);
+    REQUIRE(mpm::ParticleBase<Dim>::tensor_accessor("stresses") != nullptr);
+    REQUIRE(mpm::ParticleBase<Dim>::tensor_accessor("invalid") == nullptr);
+
     // Check vector data: velocities
     Eigen::VectorXd velocity;
     velocity.resize(Dim);
@@ -959,9 +970,16 @@ TEST_CASE("Particle is checked for 2D case", "[particle][2D]") {
     const double K = 8333333.333333333;
     REQUIRE(std::isnan(particle->pressure()) == true);
 
-    // Update volume strain rate
+    // Update volume strain rate with the strain rate of the cell
     REQUIRE(particle->volume() == Approx(1.0).epsilon(Tolerance));
+    REQUIRE(cell->volumetric_strain_rate_centroid_computed() == false);
+    cell->compute_volumetric_strain_rate_centroid(phase);
+    REQUIRE(cell->volumetric_strain_rate_centroid_computed() == true);
+    REQUIRE(cell->volumetric_strain_rate_centroid() * dt ==
+            Approx(volumetric_strain).epsilon(Tolerance));
     particle->compute_strain(dt);
+    cell->reset_volumetric_strain_rate_centroid();
+    REQUIRE(cell->volumetric_strain_rate_centroid_computed() == false);
     REQUIRE_NOTHROW(particle->update_volume());
     REQUIRE(particle->volume() == Approx(1.2).epsilon(Tolerance));
 
@@ -1250,6 +1268,36 @@ TEST_CASE("Particle is checked for 2D case", "[particle][2D]") {
                                                        mc_material) == true);
         }
 
+        SECTION("Replace material keeping state variables") {
+          REQUIRE(particle->assign_material(mc_material) == true);
+          auto evolved = state_variables;
+          evolved["pdstrain"] = 0.1;
+          evolved["cohesion"] = 1500.;
+          REQUIRE(particle->assign_material_state_vars(evolved, mc_material) ==
+                  true);
+
+          // Material with the same id and a different cohesion
+          jmaterial["cohesion"] = 3000.;
+          unsigned mid2 = 0;
+          auto replaced =
+              Factory<mpm::Material<Dim>, unsigned, const Json&>::instance()
+                  ->create("MohrCoulomb2D", std::move(mid2), jmaterial);
+
+          // State variables with the same name are kept
+          REQUIRE(particle->replace_material(replaced) == true);
+          REQUIRE(particle->state_variable("pdstrain") ==
+                  Approx(0.1).epsilon(Tolerance));
+          REQUIRE(particle->state_variable("cohesion") ==
+                  Approx(1500.).epsilon(Tolerance));
+
+          // Assigned material initialises state variables
+          REQUIRE(particle->assign_material(replaced) == true);
+          REQUIRE(particle->state_variable("pdstrain") ==
+                  Approx(0.).epsilon(Tolerance));
+          REQUIRE(particle->state_variable("cohesion") ==
+                  Approx(3000.).epsilon(Tolerance));
+        }
+
         SECTION("Assign state variables fail on state variables size") {
           // Assign material
           unsigned mid1 = 0;
@@ -0,0 +1,143 @@
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "Eigen/Dense"
+#include "catch.hpp"
+
+#include "factory.h"
+#include "particle.h"
+#include "pool.h"
+
+//! \brief Check pool class
+TEST_CASE("Pool is checked", "[pool]") {
+  // Pool with 4 slots per slab
+  auto pool = std::make_shared<mpm::Pool>(4);
+
+  // Check empty pool
+  SECTION("Check empty pool") {
+    REQUIRE(pool->nallocated() == 0);
+    REQUIRE(pool->nfree() == 0);
+    REQUIRE(pool->nslabs() == 0);
+  }
+
+  // Check allocate and deallocate
+  SECTION("Check allocate and deallocate") {
+    void* ptr1 = pool->allocate(24);
+    void* ptr2 = pool->allocate(24);
+    REQUIRE(ptr1 != ptr2);
+    REQUIRE(pool->nallocated() == 2);
+    REQUIRE(pool->nfree() == 2);
+    REQUIRE(pool->nslabs() == 1);
+
+    // Slots are aligned for vectorisable Eigen members
+    REQUIRE(mpm::Pool::alignment() >= alignof(std::max_align_t));
+    REQUIRE(mpm::Pool::alignment() >= EIGEN_MAX_ALIGN_BYTES);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(ptr1) % mpm::Pool::alignment() ==
+            0);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(ptr2) % mpm::Pool::alignment() ==
+            0);
+
+    // Released slot is reused
+    pool->deallocate(ptr1, 24);
+    REQUIRE(pool->nallocated() == 1);
+    REQUIRE(pool->nfree() == 3);
+    void* ptr3 = pool->allocate(24);
+    REQUIRE(ptr3 == ptr1);
+
+    // New slab is added when the slab is full
+    for (unsigned i = 0; i < 3; ++i) pool->allocate(24);
+    REQUIRE(pool->nallocated() == 5);
+    REQUIRE(pool->nslabs() == 2);
+
+    // Different sizes use different slabs
+    pool->allocate(1024);
+    REQUIRE(pool->nslabs() == 3);
+    REQUIRE(pool->nallocated() == 6);
+  }
+
+  // Check reserve
+  SECTION("Check reserve") {
+    pool->reserve(64, 10);
+    REQUIRE(pool->nslabs() == 3);
+    REQUIRE(pool->nfree() == 12);
+    REQUIRE(pool->nallocated() == 0);
+  }
+}
+
+//! \brief Check pool allocator with particles
+TEST_CASE("Pool allocator is checked for particles", "[pool][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Tolerance
+  const double Tolerance = 1.E-7;
+
+  auto pool = std::make_shared<mpm::Pool>(2);
+  mpm::PoolAllocator<mpm::ParticleBase<Dim>> allocator(pool);
+
+  Eigen::Matrix<double, Dim, 1> coords;
+  coords << 0.5, 1.5;
+
+  // Check allocator equality
+  SECTION("Check allocator equality") {
+    mpm::PoolAllocator<mpm::Particle<Dim>> rebind(allocator);
+    REQUIRE(rebind == allocator);
+    REQUIRE(rebind.pool() == pool);
+    mpm::PoolAllocator<mpm::Particle<Dim>> other(
+        std::make_shared<mpm::Pool>());
+    REQUIRE(other != allocator);
+  }
+
+  // Check particle creation through the factory
+  SECTION("Check particle creation in pool") {
+    std::shared_ptr<mpm::ParticleBase<Dim>> particle1 =
+        Factory<mpm::ParticleBase<Dim>, mpm::Index,
+                const Eigen::Matrix<double, Dim, 1>&>::instance()
+            ->create("P2D", allocator, static_cast<mpm::Index>(0), coords);
+    std::shared_ptr<mpm::ParticleBase<Dim>> particle2 =
+        Factory<mpm::ParticleBase<Dim>, mpm::Index,
+                const Eigen::Matrix<double, Dim, 1>&>::instance()
+            ->create("P2D", allocator, static_cast<mpm::Index>(1), coords);
+
+    REQUIRE(particle1->id() == 0);
+    REQUIRE(particle2->id() == 1);
+    for (unsigned i = 0; i < Dim; ++i)
+      REQUIRE(particle1->coordinates()(i) ==
+              Approx(coords(i)).epsilon(Tolerance));
+    REQUIRE(pool->nallocated() == 2);
+    REQUIRE(pool->nslabs() == 1);
+
+    // Release particle and reuse its slot
+    auto* address = particle1.get();
+    particle1.reset();
+    REQUIRE(pool->nallocated() == 1);
+    particle1 = Factory<mpm::ParticleBase<Dim>, mpm::Index,
+                        const Eigen::Matrix<double, Dim, 1>&>::instance()
+                    ->create("P2D", allocator, static_cast<mpm::Index>(2),
+                             coords);
+    REQUIRE(particle1.get() == address);
+    REQUIRE(particle1->id() == 2);
+    REQUIRE(pool->nallocated() == 2);
+
+    // Check invalid key
+    auto factory = Factory<mpm::ParticleBase<Dim>, mpm::Index,
+                           const Eigen::Matrix<double, Dim, 1>&>::instance();
+    REQUIRE_THROWS(factory->create("P2D2", allocator,
+                                   static_cast<mpm::Index>(3), coords));
+  }
+
+  // Pool is alive while particles exist
+  SECTION("Check pool lifetime") {
+    std::weak_ptr<mpm::Pool> weak_pool = pool;
+    auto particle = Factory<mpm::ParticleBase<Dim>, mpm::Index,
+                            const Eigen::Matrix<double, Dim, 1>&>::instance()
+                        ->create("P2D", allocator, static_cast<mpm::Index>(0),
+                                 coords);
+    allocator = mpm::PoolAllocator<mpm::ParticleBase<Dim>>(
+        std::make_shared<mpm::Pool>());
+    pool.reset();
+    REQUIRE(weak_pool.expired() == false);
+    particle.reset();
+    REQUIRE(weak_pool.expired() == true);
+  }
+}
@@ -0,0 +1,68 @@
+#include <fstream>
+#include <string>
+
+#include "catch.hpp"
+
+#include "profiler.h"
+
+//! \brief Check profiler class
+TEST_CASE("Profiler is checked", "[profiler]") {
+  // Tolerance
+  const double Tolerance = 1.E-7;
+
+  auto profiler = mpm::Profiler::instance();
+  profiler->reset();
+
+  // Check disabled profiler
+  SECTION("Check disabled profiler") {
+    profiler->enable(false);
+    {
+      mpm::ScopedTimer timer("step");
+      profiler->add_count("active_nodes", 10);
+    }
+    REQUIRE(profiler->ncalls("step") == 0);
+    REQUIRE(profiler->count("active_nodes") == Approx(0.).margin(Tolerance));
+    REQUIRE(profiler->report()["timers"].empty());
+  }
+
+  // Check nested timers and counters
+  SECTION("Check nested timers and counters") {
+    profiler->enable(true);
+    for (unsigned i = 0; i < 3; ++i) {
+      mpm::ScopedTimer timer("step");
+      {
+        mpm::ScopedTimer p2g_timer("p2g");
+        profiler->add_count("active_nodes", 4);
+      }
+      mpm::ScopedTimer g2p_timer("g2p");
+    }
+    REQUIRE(profiler->ncalls("step") == 3);
+    REQUIRE(profiler->ncalls("step/p2g") == 3);
+    REQUIRE(profiler->ncalls("step/g2p") == 3);
+    REQUIRE(profiler->ncalls("p2g") == 0);
+    REQUIRE(profiler->time("step") >= profiler->time("step/p2g"));
+    REQUIRE(profiler->count("active_nodes") == Approx(12.).epsilon(Tolerance));
+
+    // Report
+    const auto report = profiler->report();
+    REQUIRE(report["timers"].size() == 3);
+    REQUIRE(report["timers"]["step/p2g"]["calls"] ==
+            Approx(3.).epsilon(Tolerance));
+    REQUIRE(report["counters"]["active_nodes"]["max"] ==
+            Approx(12.).epsilon(Tolerance));
+    REQUIRE(report["counters"]["active_nodes"]["min"] <=
+            report["counters"]["active_nodes"]["mean"]);
+
+    // Write report
+    REQUIRE(profiler->write("profiler_test") == true);
+    std::ifstream csv_file("profiler_test.csv");
+    std::string header;
+    std::getline(csv_file, header);
+    REQUIRE(header == "type,name,calls,min,mean,max");
+
+    // Reset
+    profiler->reset();
+    REQUIRE(profiler->ncalls("step") == 0);
+    profiler->enable(false);
+  }
+}
@@ -0,0 +1,62 @@
+#include "catch.hpp"
+
+#include "bicgstab.h"
+
+//! \brief Check BiCGSTAB solver of matrix free operators
+TEST_CASE("BiCGSTAB is checked", "[bicgstab][solver]") {
+  // Tolerance
+  const double Tolerance = 1.E-9;
+
+  // Unweighted inner product
+  const auto dot = [](const Eigen::VectorXd& a, const Eigen::VectorXd& b) {
+    return a.dot(b);
+  };
+
+  // Non-symmetric diagonally dominant matrix
+  const unsigned n = 20;
+  Eigen::MatrixXd matrix = Eigen::MatrixXd::Zero(n, n);
+  for (unsigned i = 0; i < n; ++i) {
+    matrix(i, i) = 4.;
+    if (i > 0) matrix(i, i - 1) = -1.5;
+    if (i + 1 < n) matrix(i, i + 1) = -0.5;
+  }
+  const auto apply = [&matrix](const Eigen::VectorXd& x) {
+    return Eigen::VectorXd(matrix * x);
+  };
+
+  Eigen::VectorXd expected(n);
+  for (unsigned i = 0; i < n; ++i) expected(i) = 1. + 0.1 * i;
+  const Eigen::VectorXd rhs = matrix * expected;
+
+  SECTION("Check solution of a linear system") {
+    Eigen::VectorXd x = Eigen::VectorXd::Zero(n);
+    unsigned iterations = 0;
+    REQUIRE(mpm::bicgstab(apply, dot, rhs, &x, 100, 1.E-12, &iterations) ==
+            true);
+    REQUIRE(iterations > 0);
+    REQUIRE(iterations <= n);
+    for (unsigned i = 0; i < n; ++i)
+      REQUIRE(x(i) == Approx(expected(i)).epsilon(Tolerance));
+  }
+
+  SECTION("Check exact initial guess and zero rhs") {
+    Eigen::VectorXd x = expected;
+    unsigned iterations = 0;
+    REQUIRE(mpm::bicgstab(apply, dot, rhs, &x, 100, 1.E-12, &iterations) ==
+            true);
+    REQUIRE(iterations == 0);
+
+    x.setOnes();
+    REQUIRE(mpm::bicgstab(apply, dot, Eigen::VectorXd::Zero(n), &x, 100,
+                          1.E-12, &iterations) == true);
+    REQUIRE(x.norm() == Approx(0.).margin(Tolerance));
+  }
+
+  SECTION("Check iteration limit") {
+    Eigen::VectorXd x = Eigen::VectorXd::Zero(n);
+    unsigned iterations = 0;
+    REQUIRE(mpm::bicgstab(apply, dot, rhs, &x, 1, 1.E-12, &iterations) ==
+            false);
+    REQUIRE(iterations == 1);
+  }
+}
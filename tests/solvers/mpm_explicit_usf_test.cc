@@ -79,15 +79,216 @@ TEST_CASE("MPM 2D Explicit implementation is checked",
 
     // Create an IO object
     auto io = std::make_unique<mpm::IO>(argc, argv);
+
+    // Solver state of the resumed step, as after adaptive time steps
+    const std::string particles_file =
+        io->output_file("particles", ".h5", "mpm-explicit-usf-2d", 5, 10)
+            .string();
+    hid_t file_id = H5Fopen(particles_file.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+    REQUIRE(file_id >= 0);
+    const Json state = {
+        {"time", 0.0075}, {"dt", 0.0015}, {"next_output_time", 0.01}};
+    H5LTset_attribute_string(file_id, "/", "solver_state",
+                             state.dump().c_str());
+    H5Fclose(file_id);
+
     // Run explicit MPM
     auto mpm = std::make_unique<mpm::MPMExplicit<Dim>>(std::move(io));
 
     // Test check point restart
     REQUIRE(mpm->checkpoint_resume() == true);
+    // Time and time step size are restored
+    mpm->restore_solver_state();
+    const auto restored = mpm->solver_state();
+    REQUIRE(restored.at("time").template get<double>() ==
+            Approx(0.0075).epsilon(1.E-12));
+    REQUIRE(restored.at("dt").template get<double>() ==
+            Approx(0.0015).epsilon(1.E-12));
+    REQUIRE(restored.at("next_output_time").template get<double>() ==
+            Approx(0.01).epsilon(1.E-12));
     // Solve
     REQUIRE(mpm->solve() == true);
   }
 
+  SECTION("Check checkpoint resume") {
+    // Checkpoints every two steps with a full snapshot every two checkpoints
+    std::ifstream ifile("mpm-explicit-usf-2d.json");
+    Json json_file = Json::parse(ifile);
+    ifile.close();
+    const std::string uuid = "mpm-explicit-usf-checkpoint-2d";
+    json_file["analysis"]["uuid"] = uuid;
+    json_file["analysis"]["checkpoint"] = {{"steps", 2}, {"full_interval", 2}};
+    json_file["analysis"]["resume"] = {
+        {"resume", false}, {"uuid", uuid}, {"step", 6}};
+    std::ofstream ofile("mpm-explicit-usf-checkpoint-2d.json");
+    ofile << json_file.dump(2);
+    ofile.close();
+
+    // clang-format off
+    char* argv_checkpoint[] = {(char*)"./mpm",
+                               (char*)"-f",  (char*)"./",
+                               (char*)"-i",
+                               (char*)"mpm-explicit-usf-checkpoint-2d.json"};
+    // clang-format on
+
+    // Run explicit MPM
+    auto io = std::make_unique<mpm::IO>(argc, argv_checkpoint);
+    std::vector<std::string> files;
+    for (mpm::Index step = 0; step <= 10; ++step)
+      files.emplace_back(
+          io->output_file("checkpoint", ".h5", uuid, step, 10).string());
+    auto mpm = std::make_unique<mpm::MPMExplicit<Dim>>(std::move(io));
+    REQUIRE(mpm->solve() == true);
+
+    // Only full snapshots store the partition and the particles of cells
+    const auto file = [&files](mpm::Index step) { return files.at(step); };
+    REQUIRE(mpm::Checkpoint::full_step(file, 6) == 4);
+    hid_t file_id = H5Fopen(files[4].c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    REQUIRE(file_id >= 0);
+    REQUIRE(H5LTfind_dataset(file_id, "cells") == 1);
+    REQUIRE(H5LTfind_dataset(file_id, "cell_particles") == 1);
+    H5Fclose(file_id);
+
+    // Delta checkpoints store the state of the solver
+    file_id = H5Fopen(files[6].c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    REQUIRE(file_id >= 0);
+    REQUIRE(H5LTfind_dataset(file_id, "cells") == 0);
+    hsize_t dims[1] = {0};
+    H5T_class_t type_class;
+    size_t size = 0;
+    H5LTget_attribute_info(file_id, "/", "solver_state", dims, &type_class,
+                           &size);
+    std::vector<char> buffer(size + 1, '\0');
+    H5LTget_attribute_string(file_id, "/", "solver_state", buffer.data());
+    H5Fclose(file_id);
+    const Json state = Json::parse(buffer.data());
+    REQUIRE(state.find("stage") != state.end());
+
+    // Resume from the delta checkpoint
+    json_file["analysis"]["resume"]["resume"] = true;
+    ofile.open("mpm-explicit-usf-checkpoint-2d.json");
+    ofile << json_file.dump(2);
+    ofile.close();
+    io = std::make_unique<mpm::IO>(argc, argv_checkpoint);
+    mpm = std::make_unique<mpm::MPMExplicit<Dim>>(std::move(io));
+    REQUIRE(mpm->checkpoint_resume() == true);
+    mpm->restore_solver_state();
+    const auto restored = mpm->solver_state();
+    REQUIRE(restored.at("time").template get<double>() ==
+            Approx(state.at("time").template get<double>()).epsilon(1.E-12));
+    REQUIRE(restored.at("dt").template get<double>() ==
+            Approx(state.at("dt").template get<double>()).epsilon(1.E-12));
+    REQUIRE(mpm->solve() == true);
+  }
+
+  SECTION("Check resume with missing cells") {
+    // Particles written with the partition and the particles of cells
+    std::ifstream ifile("mpm-explicit-usf-2d.json");
+    Json json_file = Json::parse(ifile);
+    ifile.close();
+    const std::string uuid = "mpm-explicit-usf-cells-2d";
+    json_file["analysis"]["uuid"] = uuid;
+    json_file["analysis"]["resume"] = {
+        {"resume", false}, {"uuid", uuid}, {"step", 5}};
+    std::ofstream ofile("mpm-explicit-usf-cells-2d.json");
+    ofile << json_file.dump(2);
+    ofile.close();
+
+    // clang-format off
+    char* argv_cells[] = {(char*)"./mpm",
+                          (char*)"-f",  (char*)"./",
+                          (char*)"-i",
+                          (char*)"mpm-explicit-usf-cells-2d.json"};
+    // clang-format on
+
+    auto io = std::make_unique<mpm::IO>(argc, argv_cells);
+    const std::string particles_file =
+        io->output_file("particles", ".h5", uuid, 5, 10).string();
+    auto mpm = std::make_unique<mpm::MPMExplicit<Dim>>(std::move(io));
+    REQUIRE(mpm->solve() == true);
+
+    // Partition is restored from the cells of all ranks
+    json_file["analysis"]["resume"]["resume"] = true;
+    ofile.open("mpm-explicit-usf-cells-2d.json");
+    ofile << json_file.dump(2);
+    ofile.close();
+    io = std::make_unique<mpm::IO>(argc, argv_cells);
+    mpm = std::make_unique<mpm::MPMExplicit<Dim>>(std::move(io));
+    mpm->initialise_materials();
+    mpm->initialise_mesh();
+    mpm->initialise_particles();
+    REQUIRE(mpm->checkpoint_resume() == true);
+    REQUIRE(mpm->partition_restored() == true);
+
+    // Cells are missing on the first rank
+    int mpi_rank = 0;
+#ifdef USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
+    if (mpi_rank == 0) {
+      hid_t file_id =
+          H5Fopen(particles_file.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+      REQUIRE(file_id >= 0);
+      REQUIRE(H5Ldelete(file_id, "cells", H5P_DEFAULT) >= 0);
+      H5Fclose(file_id);
+    }
+
+    // No rank keeps the partition, particles are located by a search
+    io = std::make_unique<mpm::IO>(argc, argv_cells);
+    mpm = std::make_unique<mpm::MPMExplicit<Dim>>(std::move(io));
+    mpm->initialise_materials();
+    mpm->initialise_mesh();
+    mpm->initialise_particles();
+    REQUIRE(mpm->checkpoint_resume() == true);
+    REQUIRE(mpm->partition_restored() == false);
+  }
+
+  SECTION("Check single precision output resume") {
+    // Particles written in single precision without checkpoints
+    std::ifstream ifile("mpm-explicit-usf-2d.json");
+    Json json_file = Json::parse(ifile);
+    ifile.close();
+    const std::string uuid = "mpm-explicit-usf-single-2d";
+    json_file["analysis"]["uuid"] = uuid;
+    json_file["analysis"]["resume"] = {
+        {"resume", false}, {"uuid", uuid}, {"step", 5}};
+    json_file["post_processing"]["output_precision"] = "single";
+    std::ofstream ofile("mpm-explicit-usf-single-2d.json");
+    ofile << json_file.dump(2);
+    ofile.close();
+
+    // clang-format off
+    char* argv_single[] = {(char*)"./mpm",
+                           (char*)"-f",  (char*)"./",
+                           (char*)"-i",
+                           (char*)"mpm-explicit-usf-single-2d.json"};
+    // clang-format on
+
+    auto io = std::make_unique<mpm::IO>(argc, argv_single);
+    const std::string particles_file =
+        io->output_file("particles", ".h5", uuid, 5, 10).string();
+    auto mpm = std::make_unique<mpm::MPMExplicit<Dim>>(std::move(io));
+    REQUIRE(mpm->solve() == true);
+
+    // Restart data is not written in single precision
+    hid_t file_id =
+        H5Fopen(particles_file.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    REQUIRE(file_id >= 0);
+    REQUIRE(H5LTfind_dataset(file_id, "table") == 1);
+    REQUIRE(H5LTfind_dataset(file_id, "cells") == 0);
+    REQUIRE(H5LTfind_attribute(file_id, "solver_state") == 0);
+    H5Fclose(file_id);
+
+    // Resume from single precision particles is rejected
+    json_file["analysis"]["resume"]["resume"] = true;
+    ofile.open("mpm-explicit-usf-single-2d.json");
+    ofile << json_file.dump(2);
+    ofile.close();
+    io = std::make_unique<mpm::IO>(argc, argv_single);
+    mpm = std::make_unique<mpm::MPMExplicit<Dim>>(std::move(io));
+    REQUIRE(mpm->checkpoint_resume() == false);
+  }
+
   SECTION("Check pressure smoothing") {
     // Create an IO object
     auto io = std::make_unique<mpm::IO>(argc, argv);
@@ -96,6 +297,137 @@ TEST_CASE("MPM 2D Explicit implementation is checked",
     // Pressure smoothing
     REQUIRE_NOTHROW(mpm->pressure_smoothing(0));
   }
+
+  SECTION("Check quasi-static time step") {
+    // Adaptive time steps limited by the critical time step
+    std::ifstream ifile("mpm-explicit-usf-2d.json");
+    Json json_file = Json::parse(ifile);
+    ifile.close();
+    json_file["analysis"]["adaptive_time_stepping"] = {
+        {"courant_number", 0.5},
+        {"max_growth", 1000.},
+        {"dt_min", 0.},
+        {"dt_max", 1.}};
+
+    // Time step size of the first step
+    const auto time_step = [&](const Json& json) {
+      std::ofstream ofile("mpm-explicit-usf-2d.json");
+      ofile << json.dump(2);
+      ofile.close();
+      auto io = std::make_unique<mpm::IO>(argc, argv);
+      auto mpm = std::make_unique<mpm::MPMExplicit<Dim>>(std::move(io));
+      mpm->initialise_materials();
+      mpm->initialise_mesh();
+      mpm->initialise_particles();
+      return mpm->time_step(0);
+    };
+
+    const double dt = time_step(json_file);
+    REQUIRE(dt < 1.);
+    // Scaled inertial mass enlarges the critical time step
+    json_file["analysis"]["quasi_static"] = {{"mass_scaling", 4.}};
+    REQUIRE(time_step(json_file) == Approx(2. * dt).epsilon(1.E-12));
+  }
+
+  SECTION("Check stages") {
+    // Add stages to the JSON file
+    std::ifstream ifile("mpm-explicit-usf-2d.json");
+    Json json_file = Json::parse(ifile);
+    ifile.close();
+
+    // Particle set of the particles in cell 1
+    Json entity_sets = {
+        {"particle_sets",
+         {{{"id", 2},
+           {"set", {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}}},
+          {{"id", 3}, {"set", {4, 5, 6, 7}}}}}};
+    std::ofstream sets_file("entity_sets_stages.json");
+    sets_file << entity_sets.dump(2);
+    sets_file.close();
+    json_file["mesh"]["entity_sets"] = "entity_sets_stages.json";
+
+    // Quasi-static steps of the analysis, used by stages without their own
+    json_file["analysis"]["quasi_static"] = {{"terminate", false}};
+
+    const std::vector<double> gravity{{0., -9.81}};
+    json_file["analysis"]["stages"] = {
+        {{"nsteps", 4},
+         {"quasi_static",
+          {{"damping", "kinetic"}, {"min_steps", 2}, {"tolerance", 1.}}}},
+        {{"nsteps", 4},
+         {"dt", 0.0005},
+         {"damping", {{"type", "Cundall"}, {"damping_factor", 0.05}}},
+         {"materials",
+          {{{"id", 1},
+            {"type", "LinearElastic2D"},
+            {"density", 2300.},
+            {"youngs_modulus", 3.0E+6},
+            {"poisson_ratio", 0.25}}}},
+         {"material_sets", {{{"material_id", 0}, {"pset_id", 2}}}},
+         {"remove_particle_sets", {3}},
+         {"boundary_conditions",
+          {{"velocity_constraints",
+            {{{"nset_id", -1}, {"dir", 1}, {"velocity", 0.}}}}}},
+         {"external_loading_conditions", {{"gravity", gravity}}}}};
+
+    std::ofstream ofile("mpm-explicit-usf-stages-2d.json");
+    ofile << json_file.dump(2);
+    ofile.close();
+
+    // clang-format off
+    char* argv_stages[] = {(char*)"./mpm",
+                           (char*)"-f",  (char*)"./",
+                           (char*)"-i",
+                           (char*)"mpm-explicit-usf-stages-2d.json"};
+    // clang-format on
+
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv_stages);
+    // Run explicit MPM
+    auto mpm = std::make_unique<mpm::MPMExplicit<Dim>>(std::move(io));
+    REQUIRE(mpm->nstages() == 2);
+    // Solve
+    REQUIRE(mpm->solve() == true);
+
+    // Last stage runs its steps from its start with its time step size and
+    // the quasi-static steps of the analysis
+    const auto state = mpm->solver_state();
+    REQUIRE(state.at("stage").template get<unsigned>() == 1);
+    REQUIRE(state.at("stage_end").template get<mpm::Index>() ==
+            state.at("stage_start").template get<mpm::Index>() + 4);
+    REQUIRE(state.at("dt").template get<double>() ==
+            Approx(0.0005).epsilon(1.E-12));
+    REQUIRE(state.find("quasi_static") != state.end());
+
+    // Particles of the removed set are no longer in the mesh
+    auto mesh = mpm->mesh();
+    REQUIRE(mesh->nparticles() == 4);
+    REQUIRE(mesh->remove_particle_set(3) == true);
+    REQUIRE(mesh->nparticles() == 4);
+
+    // Velocity constraints of the stage replace the initial ones
+    const unsigned phase = 0;
+    auto node = mesh->node(0);
+    node->update_mass(false, phase, 1.);
+    node->update_momentum(false, phase, Eigen::Vector2d(1., 1.));
+    node->compute_velocity();
+    REQUIRE(node->velocity(phase)(0) == Approx(1.).epsilon(1.E-12));
+    REQUIRE(node->velocity(phase)(1) == Approx(0.).margin(1.E-12));
+
+    // Concentrated forces of the initial loads are cleared
+    node->update_external_force(false, phase, Eigen::Vector2d::Zero());
+    node->apply_concentrated_force(phase, 0.5);
+    REQUIRE(node->external_force(phase).norm() == Approx(0.).margin(1.E-12));
+
+    // Undefined particle sets are not removed
+    json_file["analysis"]["stages"][1]["remove_particle_sets"] = {5};
+    ofile.open("mpm-explicit-usf-stages-2d.json");
+    ofile << json_file.dump(2);
+    ofile.close();
+    io = std::make_unique<mpm::IO>(argc, argv_stages);
+    mpm = std::make_unique<mpm::MPMExplicit<Dim>>(std::move(io));
+    REQUIRE(mpm->solve() == false);
+  }
 }
 
 // Check MPM Explicit
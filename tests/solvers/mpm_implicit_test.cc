@@ -0,0 +1,260 @@
+#include "catch.hpp"
+
+//! Alias for JSON
+#include "json.hpp"
+using Json = nlohmann::json;
+
+#include "mpm_implicit.h"
+#include "write_mesh_particles.h"
+
+// Check MPM Implicit
+TEST_CASE("MPM 2D Implicit implementation is checked",
+          "[MPM][2D][Implicit][1Phase]") {
+  // Dimension
+  const unsigned Dim = 2;
+
+  // Write JSON file
+  const std::string fname = "mpm-implicit";
+  const std::string analysis = "MPMImplicit2D";
+  const std::string mpm_scheme = "usf";
+  bool resume = false;
+  REQUIRE(mpm_test::write_json(2, resume, analysis, mpm_scheme, fname) == true);
+
+  // Write JSON Entity Sets file
+  REQUIRE(mpm_test::write_entity_set() == true);
+
+  // Write Mesh
+  REQUIRE(mpm_test::write_mesh_2d() == true);
+
+  // Write Particles
+  REQUIRE(mpm_test::write_particles_2d() == true);
+
+  // Assign argc and argv to input arguments of MPM
+  int argc = 5;
+  // clang-format off
+  char* argv[] = {(char*)"./mpm",
+                  (char*)"-f",  (char*)"./",
+                  (char*)"-i",  (char*)"mpm-implicit-2d.json"};
+  // clang-format on
+
+  SECTION("Check initialisation") {
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Run implicit MPM
+    auto mpm = std::make_unique<mpm::MPMImplicit<Dim>>(std::move(io));
+
+    // Initialise materials
+    REQUIRE_NOTHROW(mpm->initialise_materials());
+    // Initialise mesh
+    REQUIRE_NOTHROW(mpm->initialise_mesh());
+    // Initialise particles
+    REQUIRE_NOTHROW(mpm->initialise_particles());
+
+    // Initialise external loading
+    REQUIRE_NOTHROW(mpm->initialise_loads());
+
+    // Renitialise materials
+    REQUIRE_THROWS(mpm->initialise_materials());
+  }
+
+  SECTION("Check solver") {
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Run implicit MPM
+    auto mpm = std::make_unique<mpm::MPMImplicit<Dim>>(std::move(io));
+    // Solve
+    REQUIRE(mpm->solve() == true);
+    // Test check point restart
+    REQUIRE(mpm->checkpoint_resume() == false);
+
+    // Residual of a linear elastic material is affine in the nodal
+    // velocities, the finite difference Jacobian is the change of residual
+    const unsigned phase = 0;
+    const Eigen::VectorXd velocity = mpm->solution();
+    REQUIRE(velocity.size() > 0);
+    const Eigen::VectorXd direction = Eigen::VectorXd::Random(velocity.size());
+    const Eigen::VectorXd residual = mpm->residual(velocity, phase);
+    const Eigen::VectorXd jacobian =
+        mpm->jacobian(velocity, residual, direction, phase);
+    const Eigen::VectorXd change =
+        mpm->residual(velocity + direction, phase) - residual;
+    for (unsigned i = 0; i < velocity.size(); ++i)
+      REQUIRE(jacobian(i) == Approx(change(i)).epsilon(1.E-5).margin(1.E-8));
+    // Zero direction
+    REQUIRE(mpm->jacobian(velocity, residual,
+                          Eigen::VectorXd::Zero(velocity.size()), phase)
+                .norm() == Approx(0.).margin(1.E-15));
+  }
+
+  SECTION("Check resume") {
+    // Write JSON file
+    bool resume = true;
+    REQUIRE(mpm_test::write_json(2, resume, analysis, mpm_scheme, fname) ==
+            true);
+
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Run implicit MPM
+    auto mpm = std::make_unique<mpm::MPMImplicit<Dim>>(std::move(io));
+
+    // Test check point restart
+    REQUIRE(mpm->checkpoint_resume() == true);
+    // Solve
+    REQUIRE(mpm->solve() == true);
+  }
+}
+
+// Check MPM Implicit free fall against the analytical solution
+TEST_CASE("MPM 2D Implicit free fall is checked",
+          "[MPM][2D][Implicit][1Phase]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Tolerance
+  const double Tolerance = 1.E-6;
+  // Acceleration due to gravity
+  const double gravity = -9.81;
+
+  // Write JSON file with gravity as the only load
+  const std::string fname = "mpm-implicit-free-fall";
+  const std::string analysis = "MPMImplicit2D";
+  const std::string mpm_scheme = "usf";
+  const bool resume = false;
+  REQUIRE(mpm_test::write_json(2, resume, analysis, mpm_scheme, fname) == true);
+  std::ifstream ifile("mpm-implicit-free-fall-2d.json");
+  Json json_file = Json::parse(ifile);
+  ifile.close();
+  json_file["external_loading_conditions"].erase("particle_surface_traction");
+  json_file["external_loading_conditions"].erase("concentrated_nodal_forces");
+  std::ofstream ofile("mpm-implicit-free-fall-2d.json");
+  ofile << json_file.dump(2);
+  ofile.close();
+
+  // Write JSON Entity Sets file
+  REQUIRE(mpm_test::write_entity_set() == true);
+
+  // Write Mesh
+  REQUIRE(mpm_test::write_mesh_2d() == true);
+
+  // Write Particles
+  REQUIRE(mpm_test::write_particles_2d() == true);
+
+  // Assign argc and argv to input arguments of MPM
+  int argc = 5;
+  // clang-format off
+  char* argv[] = {(char*)"./mpm",
+                  (char*)"-f",  (char*)"./",
+                  (char*)"-i",  (char*)"mpm-implicit-free-fall-2d.json"};
+  // clang-format on
+
+  // Create an IO object
+  auto io = std::make_unique<mpm::IO>(argc, argv);
+  const std::string particles_file =
+      io->output_file("particles", ".h5", "mpm-implicit-free-fall-2d", 5, 10)
+          .string();
+  // Run implicit MPM
+  auto mpm = std::make_unique<mpm::MPMImplicit<Dim>>(std::move(io));
+  REQUIRE(mpm->solve() == true);
+
+  hid_t file_id = H5Fopen(particles_file.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  REQUIRE(file_id >= 0);
+
+  // Time of the output step
+  hsize_t dims = 0;
+  H5T_class_t type_class;
+  size_t type_size = 0;
+  H5LTget_attribute_info(file_id, "/", "solver_state", &dims, &type_class,
+                         &type_size);
+  std::vector<char> state(type_size + 1, '\0');
+  H5LTget_attribute_string(file_id, "/", "solver_state", state.data());
+  const double time =
+      Json::parse(state.data()).at("time").template get<double>();
+  REQUIRE(time > 0.);
+
+  // Particles of the output step
+  unsigned nstate_vars = 0;
+  H5LTget_attribute_uint(file_id, "table", "nstate_vars", &nstate_vars);
+  mpm::hdf5::particle::CompactLayout layout(Dim, nstate_vars, false);
+  hsize_t nfields = 0;
+  hsize_t nrecords = 0;
+  H5TBget_table_info(file_id, "table", &nfields, &nrecords);
+  std::vector<char> records(nrecords * layout.record_size());
+  H5TBread_table(file_id, "table", layout.record_size(), layout.offsets(),
+                 layout.sizes(), records.data());
+  H5Fclose(file_id);
+  REQUIRE(nrecords == 8);
+
+  // Uniform acceleration of gravity without strains
+  for (hsize_t i = 0; i < nrecords; ++i) {
+    mpm::HDF5Particle particle;
+    layout.unpack(records.data() + i * layout.record_size(), &particle);
+    REQUIRE(particle.velocity_x == Approx(0.).margin(Tolerance));
+    REQUIRE(particle.velocity_y ==
+            Approx(gravity * time).epsilon(Tolerance).margin(1.E-12));
+    REQUIRE(particle.displacement_y ==
+            Approx(0.5 * gravity * time * time)
+                .epsilon(Tolerance)
+                .margin(1.E-12));
+    REQUIRE(particle.strain_yy == Approx(0.).margin(Tolerance));
+    REQUIRE(particle.stress_yy == Approx(0.).margin(Tolerance));
+  }
+}
+
+// Check MPM Implicit
+TEST_CASE("MPM 3D Implicit implementation is checked",
+          "[MPM][3D][Implicit][1Phase]") {
+  // Dimension
+  const unsigned Dim = 3;
+
+  // Write JSON file
+  const std::string fname = "mpm-implicit";
+  const std::string analysis = "MPMImplicit3D";
+  const std::string mpm_scheme = "usf";
+  const bool resume = false;
+  REQUIRE(mpm_test::write_json(3, resume, analysis, mpm_scheme, fname) == true);
+
+  // Write JSON Entity Sets file
+  REQUIRE(mpm_test::write_entity_set() == true);
+
+  // Write Mesh
+  REQUIRE(mpm_test::write_mesh_3d() == true);
+
+  // Write Particles
+  REQUIRE(mpm_test::write_particles_3d() == true);
+
+  // Assign argc and argv to input arguments of MPM
+  int argc = 5;
+  // clang-format off
+  char* argv[] = {(char*)"./mpm",
+                  (char*)"-f",  (char*)"./",
+                  (char*)"-i",  (char*)"mpm-implicit-3d.json"};
+  // clang-format on
+
+  SECTION("Check initialisation") {
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Run implicit MPM
+    auto mpm = std::make_unique<mpm::MPMImplicit<Dim>>(std::move(io));
+
+    // Initialise materials
+    REQUIRE_NOTHROW(mpm->initialise_materials());
+    // Initialise mesh
+    REQUIRE_NOTHROW(mpm->initialise_mesh());
+    // Initialise particles
+    REQUIRE_NOTHROW(mpm->initialise_particles());
+
+    // Initialise external loading
+    REQUIRE_NOTHROW(mpm->initialise_loads());
+
+    // Renitialise materials
+    REQUIRE_THROWS(mpm->initialise_materials());
+  }
+
+  SECTION("Check solver") {
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Run implicit MPM
+    auto mpm = std::make_unique<mpm::MPMImplicit<Dim>>(std::move(io));
+    // Solve
+    REQUIRE(mpm->solve() == true);
+  }
+}
@@ -202,6 +202,8 @@ TEST_CASE("Stress update is checked for USF and USL",
         mpm_scheme->compute_particle_kinematics(true, phase, "None", 0.02));
     REQUIRE_NOTHROW(
         mpm_scheme->compute_particle_kinematics(false, phase, "None", 0.02));
+    REQUIRE_NOTHROW(mpm_scheme->compute_particle_kinematics(
+        false, phase, "Viscous", 0.5, 100.));
 
     // Update Stress Last
     REQUIRE_NOTHROW(mpm_scheme->postcompute_stress_strain(phase, true));
@@ -243,6 +245,8 @@ TEST_CASE("Stress update is checked for USF and USL",
         mpm_scheme->compute_particle_kinematics(true, phase, "None", 0.02));
     REQUIRE_NOTHROW(
         mpm_scheme->compute_particle_kinematics(false, phase, "None", 0.02));
+    REQUIRE_NOTHROW(mpm_scheme->compute_particle_kinematics(
+        false, phase, "Viscous", 0.5, 100.));
 
     // Update Stress Last
     REQUIRE_NOTHROW(mpm_scheme->postcompute_stress_strain(phase, true));
@@ -0,0 +1,105 @@
+#include <cmath>
+
+#include "catch.hpp"
+
+#include "quasi_static.h"
+
+//! \brief Check quasi-static damping and convergence
+TEST_CASE("Quasi-static steps are checked", "[quasi_static][solver]") {
+  // Tolerance
+  const double Tolerance = 1.E-7;
+
+  SECTION("Check properties") {
+    mpm::QuasiStatic quasi_static(Json::object());
+    REQUIRE(quasi_static.damping() == mpm::QuasiStaticDamping::Kinetic);
+    REQUIRE(quasi_static.damping_coefficient() == Approx(0.).margin(Tolerance));
+    REQUIRE(quasi_static.mass_scaling() == Approx(1.).epsilon(Tolerance));
+    REQUIRE(quasi_static.terminate() == true);
+    REQUIRE(quasi_static.converged() == false);
+
+    Json props = {{"damping", "viscous"}, {"mass_scaling", 10.}};
+    mpm::QuasiStatic viscous(props);
+    REQUIRE(viscous.damping() == mpm::QuasiStaticDamping::Viscous);
+    REQUIRE(viscous.mass_scaling() == Approx(10.).epsilon(Tolerance));
+
+    // Invalid damping and mass scaling
+    props["damping"] = "Cundall";
+    REQUIRE_THROWS(mpm::QuasiStatic(props));
+    props["damping"] = "kinetic";
+    props["mass_scaling"] = 0.;
+    REQUIRE_THROWS(mpm::QuasiStatic(props));
+  }
+
+  SECTION("Check kinetic damping") {
+    Json props = {{"damping", "kinetic"}};
+    mpm::QuasiStatic quasi_static(props);
+
+    const std::vector<double> energies{1., 2., 3., 2., 1., 2.};
+    const std::vector<bool> resets{false, false, false, true, false, false};
+    for (unsigned i = 0; i < energies.size(); ++i) {
+      quasi_static.update(0.1 * (i + 1), energies[i], 1.);
+      REQUIRE(quasi_static.reset_velocities() == resets[i]);
+      REQUIRE(quasi_static.damping_coefficient() ==
+              Approx(0.).margin(Tolerance));
+    }
+  }
+
+  SECTION("Check viscous damping") {
+    Json props = {{"damping", "viscous"}, {"damping_ratio", 0.5}};
+    mpm::QuasiStatic quasi_static(props);
+
+    // Kinetic energy of a vibration with a frequency of 2 rad/s
+    const double frequency = 2.;
+    const double dt = 1.E-3;
+    for (unsigned i = 1; i <= 4000; ++i) {
+      const double time = i * dt;
+      quasi_static.update(time, std::pow(std::sin(frequency * time), 2), 1.);
+      REQUIRE(quasi_static.reset_velocities() == false);
+    }
+    // Damping coefficient is a fraction of the critical damping
+    REQUIRE(quasi_static.damping_coefficient() ==
+            Approx(2. * 0.5 * frequency).epsilon(1.E-3));
+  }
+
+  SECTION("Check resumed state") {
+    Json props = {{"damping", "viscous"}, {"damping_ratio", 0.5}};
+    mpm::QuasiStatic quasi_static(props);
+    mpm::QuasiStatic resumed(props);
+
+    // Kinetic energy of a vibration with a frequency of 2 rad/s
+    const double frequency = 2.;
+    const double dt = 1.E-3;
+    for (unsigned i = 1; i <= 4000; ++i) {
+      const double time = i * dt;
+      // Resume half way between peaks
+      if (i == 2000) resumed.assign_state(quasi_static.state());
+      const double energy = std::pow(std::sin(frequency * time), 2);
+      quasi_static.update(time, energy, 1.);
+      if (i >= 2000) resumed.update(time, energy, 1.);
+    }
+    REQUIRE(resumed.damping_coefficient() > 0.);
+    REQUIRE(resumed.damping_coefficient() ==
+            Approx(quasi_static.damping_coefficient()).epsilon(Tolerance));
+    REQUIRE(resumed.state() == quasi_static.state());
+
+    // Incomplete state
+    REQUIRE_THROWS(resumed.assign_state(Json::object()));
+  }
+
+  SECTION("Check convergence") {
+    Json props = {{"tolerance", 1.E-3}, {"min_steps", 3}, {"terminate", false}};
+    mpm::QuasiStatic quasi_static(props);
+    REQUIRE(quasi_static.terminate() == false);
+
+    quasi_static.update(0.1, 1., 1.E-4);
+    REQUIRE(quasi_static.converged() == false);
+    quasi_static.update(0.2, 1., 1.E-2);
+    REQUIRE(quasi_static.converged() == false);
+    quasi_static.update(0.3, 1., 1.E-4);
+    REQUIRE(quasi_static.converged() == true);
+    REQUIRE(quasi_static.unbalanced_ratio() ==
+            Approx(1.E-4).epsilon(Tolerance));
+    quasi_static.update(0.4, 1., 1.E-2);
+    REQUIRE(quasi_static.converged() == false);
+  }
+}